@@ -4,7 +4,7 @@ if (COVERAGE_FLAGS AND GCOVR AND (NOT MSVC))
     find_program(GCOVR_EXEC "gcovr")
     if(GCOVR_EXEC)
         message(STATUS "Using gcovr")
-        include(${PROJECT_SOURCE_DIR}/cmake/tools/test_helper.cmake)
+        include(${PROJECT_SOURCE_DIR}/cmake/YACHT/tools/test_helper.cmake)
         execute_process(COMMAND ${CMAKE_COMMAND} -E make_directory ./gcovr/ WORKING_DIRECTORY ${CMAKE_BINARY_DIR})
         string(REPLACE " " "%20" url_root_path "${CMAKE_BINARY_DIR}")
         if (CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang|Intel")
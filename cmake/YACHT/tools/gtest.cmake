@@ -4,7 +4,7 @@ macro(gtest_find)
     if (NOT gtest_was_found)
         message(STATUS "GTest was requested. Setting up...")
         enable_testing()
-        include(${PROJECT_SOURCE_DIR}/cmake/tools/test_helper.cmake)
+        include(${PROJECT_SOURCE_DIR}/cmake/YACHT/tools/test_helper.cmake)
 
         set(find_gtest_cond "REQUIRED")
         if (GTEST_DOWNLOAD_IF_MISSING)
@@ -5,7 +5,7 @@ if (COVERAGE_FLAGS AND LCOV AND (NOT MSVC))
     find_program(GENHTML_EXEC "genhtml")
     if(LCOV_EXEC AND GENHTML_EXEC)
         message(STATUS "Using lcov")
-        include(${PROJECT_SOURCE_DIR}/cmake/tools/test_helper.cmake)
+        include(${PROJECT_SOURCE_DIR}/cmake/YACHT/tools/test_helper.cmake)
         execute_process(COMMAND ${CMAKE_COMMAND} -E make_directory ./lcov/ WORKING_DIRECTORY ${CMAKE_BINARY_DIR})
         string(REPLACE " " "%20" url_root_path "${CMAKE_BINARY_DIR}")
         if (CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang|Intel")
@@ -2,7 +2,7 @@ macro(libfuzz_check)
     if (NOT libfuzz_cheched)
         message(STATUS "Libfuzz was requested. Setting up...")
         enable_testing()
-        include(${PROJECT_SOURCE_DIR}/cmake/tools/test_helper.cmake)
+        include(${PROJECT_SOURCE_DIR}/cmake/YACHT/tools/test_helper.cmake)
         set(libfuzz_cheched ON)
 
         if (NOT (CMAKE_CXX_COMPILER_ID STREQUAL "Clang"))
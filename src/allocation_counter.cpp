@@ -0,0 +1,53 @@
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.hpp"
+
+namespace {
+// Per thread, so work on background threads doesn't show up in the render loop's numbers
+thread_local std::size_t allocations = 0;
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocations++;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+    std::free(pointer);
+}
+
+namespace wordle {
+
+std::size_t allocation_count() {
+    return allocations;
+}
+
+void* counted_malloc(std::size_t size) {
+    allocations++;
+    return std::malloc(size);
+}
+
+void* counted_calloc(std::size_t count, std::size_t size) {
+    allocations++;
+    return std::calloc(count, size);
+}
+
+// Growing or shrinking in place still counts, there is no telling from here
+void* counted_realloc(void* pointer, std::size_t size) {
+    allocations++;
+    return std::realloc(pointer, size);
+}
+
+void counted_free(void* pointer) {
+    std::free(pointer);
+}
+
+}; // namespace wordle
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace wordle {
+
+// Number of heap allocations made by the calling thread. Only counts in executables that link
+// allocation_counter.cpp, which replaces the global operator new. ImGui and SDL allocate through malloc, they are
+// counted once handed the functions below with ImGui::SetAllocatorFunctions and SDL_SetMemoryFunctions.
+std::size_t allocation_count();
+
+// malloc and friends, counted like operator new
+void* counted_malloc(std::size_t size);
+void* counted_calloc(std::size_t count, std::size_t size);
+void* counted_realloc(void* pointer, std::size_t size);
+void counted_free(void* pointer);
+
+}; // namespace wordle
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <chrono>
+
+#include "analysis_service.hpp"
+#include "solver.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+template <std::size_t N>
+BasicAnalysisService<N>::BasicAnalysisService(BasicFeedbackMatrix<N> const& matrix, std::span<const PackedWord> guesses, std::span<const float> answer_weights,
+                                              ThreadPool& pool, std::function<void()> on_result)
+    : matrix_(matrix), guesses_(guesses), answer_weights_(answer_weights), pool_(pool), on_result_(std::move(on_result)),
+      worker_([this](std::stop_token stop) { run(stop); }) {}
+
+template <std::size_t N>
+BasicAnalysisService<N>::~BasicAnalysisService() {
+    cancel();
+}
+
+template <std::size_t N>
+void BasicAnalysisService<N>::submit(std::span<const PackedWord> guesses, std::span<const Feedback> feedback) {
+    Job job;
+    job.generation = ++generation_;
+    job.rows = std::min({guesses.size(), feedback.size(), job.guesses.size()});
+    std::copy_n(guesses.begin(), job.rows, job.guesses.begin());
+    std::copy_n(feedback.begin(), job.rows, job.feedback.begin());
+
+    {
+        std::lock_guard lock(mutex_);
+        current_stop_.request_stop();
+        current_stop_ = std::stop_source();
+        job.stop = current_stop_.get_token();
+        pending_ = job;
+    }
+    wake_.notify_one();
+}
+
+template <std::size_t N>
+void BasicAnalysisService<N>::cancel() {
+    ++generation_;
+
+    std::lock_guard lock(mutex_);
+    current_stop_.request_stop();
+    pending_.reset();
+}
+
+template <std::size_t N>
+std::optional<AnalysisResult> BasicAnalysisService<N>::poll() {
+    while (auto result = results_.try_pop()) {
+        if (result->generation == generation_) {
+            return result;
+        }
+    }
+    return {};
+}
+
+template <std::size_t N>
+void BasicAnalysisService<N>::run(std::stop_token thread_stop) {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock lock(mutex_);
+            if (not wake_.wait(lock, thread_stop, [this]() { return pending_.has_value(); })) {
+                return;
+            }
+            job = *pending_;
+            pending_.reset();
+        }
+
+        WORDLE_TRACE_SCOPE("analysis_job");
+        const auto start = std::chrono::steady_clock::now();
+
+        BasicSolver<N> solver(matrix_, &pool_, answer_weights_);
+        for (std::size_t row = 0; row < job.rows; row++) {
+            const auto it = std::find(guesses_.begin(), guesses_.end(), job.guesses[row]);
+            if (it != guesses_.end()) {
+                solver.apply(static_cast<std::size_t>(it - guesses_.begin()), job.feedback[row]);
+            }
+        }
+
+        AnalysisResult result;
+        result.generation = job.generation;
+        result.remaining = solver.remaining().size();
+
+        if (result.remaining > 0) {
+            const auto suggestion = solver.best_guess(job.stop);
+            if (not suggestion) {
+                continue;
+            }
+            result.guess = suggestion->guess;
+            result.entropy = suggestion->entropy;
+        }
+
+        result.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // A full queue means the UI is far behind, the newest result is the one worth keeping but dropping is fine
+        if (results_.try_push(result) && on_result_) {
+            on_result_();
+        }
+    }
+}
+
+template class BasicAnalysisService<4>;
+template class BasicAnalysisService<5>;
+template class BasicAnalysisService<6>;
+template class BasicAnalysisService<7>;
+template class BasicAnalysisService<8>;
+
+}; // namespace wordle
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <thread>
+
+#include "feedback_matrix.hpp"
+#include "game.hpp"
+#include "spsc_queue.hpp"
+#include "thread_pool.hpp"
+
+namespace wordle {
+
+struct AnalysisResult {
+    std::uint64_t generation = 0;
+    std::size_t guess = 0; // index in the guess list
+    double entropy = 0.0;
+    std::size_t remaining = 0;
+    double elapsed_ms = 0.0;
+};
+
+// Runs the solver away from the render thread. The UI thread submits the game so far and polls for results once
+// per frame, results travel back through a lock-free queue. Submitting again or cancelling stops the job in flight
+// and throws away anything it would still produce. on_result is called from the worker after each result is queued,
+// to wake up a UI that sleeps between events. Answer weights, if any, are handed to the solver.
+template <std::size_t N>
+class BasicAnalysisService {
+  public:
+    using Feedback = FeedbackOf<N>;
+
+    BasicAnalysisService(BasicFeedbackMatrix<N> const& matrix, std::span<const PackedWord> guesses, std::span<const float> answer_weights, ThreadPool& pool,
+                         std::function<void()> on_result = {});
+    ~BasicAnalysisService();
+
+    BasicAnalysisService(BasicAnalysisService const&) = delete;
+    BasicAnalysisService& operator=(BasicAnalysisService const&) = delete;
+
+    // UI thread only
+    void submit(std::span<const PackedWord> guesses, std::span<const Feedback> feedback);
+    void cancel();
+    std::optional<AnalysisResult> poll();
+
+  private:
+    struct Job {
+        std::uint64_t generation = 0;
+        std::array<PackedWord, BasicGame<N>::max_rows> guesses{};
+        std::array<Feedback, BasicGame<N>::max_rows> feedback{};
+        std::size_t rows = 0;
+        std::stop_token stop;
+    };
+
+    void run(std::stop_token thread_stop);
+
+    BasicFeedbackMatrix<N> const& matrix_;
+    std::span<const PackedWord> guesses_;
+    std::span<const float> answer_weights_;
+    ThreadPool& pool_;
+    std::function<void()> on_result_;
+
+    std::uint64_t generation_ = 0; // only touched by the UI thread
+    SpscQueue<AnalysisResult, 16> results_;
+
+    std::mutex mutex_;
+    std::condition_variable_any wake_;
+    std::optional<Job> pending_;
+    std::stop_source current_stop_;
+
+    std::jthread worker_; // last, so it is joined before anything it uses goes away
+};
+
+using AnalysisService = BasicAnalysisService<word_length>;
+
+}; // namespace wordle
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "feedback_matrix.hpp"
+#include "game.hpp"
+#include "strategy.hpp"
+#include "thread_pool.hpp"
+#include "word_list.hpp"
+
+namespace {
+struct GameResult {
+    std::size_t tries = 0;
+    bool won = false;
+    double latency_us = 0.0;
+};
+
+struct Options {
+    std::string strategy = "entropy";
+    std::string json_path;
+    std::size_t max_tries = 6;
+    std::size_t threads = 0;
+};
+
+double percentile(std::vector<double> sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const auto index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--strategy" && has_value) {
+            options.strategy = argv[++i];
+        } else if (arg == "--json" && has_value) {
+            options.json_path = argv[++i];
+        } else if (arg == "--max-tries" && has_value) {
+            options.max_tries = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && has_value) {
+            options.threads = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            fmt::print("Usage: {} [--strategy first|entropy] [--json FILE] [--max-tries N] [--threads N]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    options.max_tries = std::clamp<std::size_t>(options.max_tries, 1, wordle::Game::max_rows);
+
+    const auto lists = wordle::load_word_lists("assets");
+    if (lists.answers.empty()) {
+        fmt::print("[ERROR] Couldn't load the word lists from assets/\n");
+        return EXIT_FAILURE;
+    }
+    const auto matrix = wordle::FeedbackMatrix::load_or_build("assets/feedback_matrix.bin", lists.guesses.words(), lists.answers);
+
+    wordle::ThreadPool pool(options.threads != 0 ? options.threads : std::thread::hardware_concurrency());
+
+    const auto factory = wordle::make_strategy_factory(options.strategy, matrix, pool);
+    if (not factory) {
+        fmt::print("[ERROR] Unknown strategy {}\n", options.strategy);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<GameResult> results(lists.answers.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    pool.parallel_for(lists.answers.size(), 16, [&](std::size_t first, std::size_t last) {
+        const auto strategy = (*factory)();
+
+        for (std::size_t answer = first; answer < last; answer++) {
+            const auto game_start = std::chrono::steady_clock::now();
+
+            auto game = wordle::Game(lists.answers[answer], options.max_tries);
+            strategy->new_game();
+            while (game.state() == wordle::GameState::PLAYING) {
+                const auto guess = strategy->next_guess();
+                strategy->observe(guess, game.submit(lists.guesses[guess]));
+            }
+
+            results[answer] = {game.tries(), game.state() == wordle::GameState::WON,
+                               std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - game_start).count()};
+        }
+    });
+    const auto elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // histogram[n] counts games won in n guesses, histogram[0] counts the lost ones
+    std::vector<std::size_t> histogram(options.max_tries + 1);
+    std::vector<double> latencies;
+    latencies.reserve(results.size());
+    std::size_t total_guesses = 0;
+    for (auto const& result : results) {
+        histogram[result.won ? result.tries : 0]++;
+        latencies.push_back(result.latency_us);
+        total_guesses += result.tries;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto games = static_cast<double>(results.size());
+    const auto games_per_second = games / elapsed_s;
+    const auto failure_rate = static_cast<double>(histogram[0]) / games;
+    const auto mean_guesses = static_cast<double>(total_guesses) / games;
+    const auto p50 = percentile(latencies, 0.50);
+    const auto p99 = percentile(latencies, 0.99);
+
+    fmt::print("Strategy {} on {} threads, {} games in {:.3f} s ({:.1f} games/s)\n", options.strategy, pool.thread_count(), results.size(), elapsed_s,
+               games_per_second);
+    for (std::size_t tries = 1; tries <= options.max_tries; tries++) {
+        fmt::print("  {} guesses: {}\n", tries, histogram[tries]);
+    }
+    fmt::print("  lost: {} ({:.2f}%)\n", histogram[0], failure_rate * 100.0);
+    fmt::print("Mean guesses {:.4f}, latency p50 {:.1f} us, p99 {:.1f} us\n", mean_guesses, p50, p99);
+
+    if (not options.json_path.empty()) {
+        std::string histogram_json;
+        for (std::size_t tries = 1; tries <= options.max_tries; tries++) {
+            histogram_json += fmt::format("{}\"{}\": {}", tries > 1 ? ", " : "", tries, histogram[tries]);
+        }
+
+        std::ofstream file(options.json_path);
+        file << fmt::format("{{\n"
+                            "  \"strategy\": \"{}\",\n"
+                            "  \"threads\": {},\n"
+                            "  \"games\": {},\n"
+                            "  \"max_tries\": {},\n"
+                            "  \"seconds\": {:.6f},\n"
+                            "  \"games_per_second\": {:.3f},\n"
+                            "  \"histogram\": {{{}}},\n"
+                            "  \"failures\": {},\n"
+                            "  \"failure_rate\": {:.6f},\n"
+                            "  \"mean_guesses\": {:.6f},\n"
+                            "  \"latency_us\": {{\"p50\": {:.3f}, \"p99\": {:.3f}}}\n"
+                            "}}\n",
+                            options.strategy, pool.thread_count(), results.size(), options.max_tries, elapsed_s, games_per_second, histogram_json, histogram[0],
+                            failure_rate, mean_guesses, p50, p99);
+        if (not file) {
+            fmt::print("[ERROR] Couldn't write {}\n", options.json_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
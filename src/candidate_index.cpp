@@ -0,0 +1,116 @@
+#include <bit>
+#include <cassert>
+
+#include "candidate_index.hpp"
+
+namespace wordle {
+
+namespace {
+constexpr std::size_t letter_count = 26;
+
+std::size_t letter_at(PackedWord word, std::size_t i) {
+    return static_cast<std::size_t>(((word >> (8 * i)) & 0xFF) - 'A');
+}
+} // namespace
+
+template <std::size_t N>
+BasicCandidateIndex<N>::BasicCandidateIndex(std::span<const PackedWord> answers)
+    : answer_count_(answers.size()), block_count_((answers.size() + 63) / 64), live_(block_count_), full_(block_count_),
+      position_masks_(N * letter_count * block_count_), at_least_masks_(letter_count * N * block_count_) {
+    for (std::size_t a = 0; a < answers.size(); a++) {
+        const auto block = a / 64;
+        const auto bit = Block{1} << (a % 64);
+
+        full_[block] |= bit;
+
+        std::array<std::size_t, letter_count> counts{};
+        for (std::size_t i = 0; i < N; i++) {
+            const auto letter = letter_at(answers[a], i);
+            assert(letter < letter_count);
+            position_masks_[(i * letter_count + letter) * block_count_ + block] |= bit;
+            counts[letter]++;
+        }
+
+        for (std::size_t letter = 0; letter < letter_count; letter++) {
+            for (std::size_t c = 1; c <= counts[letter]; c++) {
+                at_least_masks_[(letter * N + c - 1) * block_count_ + block] |= bit;
+            }
+        }
+    }
+
+    reset();
+}
+
+template <std::size_t N>
+std::span<const typename BasicCandidateIndex<N>::Block> BasicCandidateIndex<N>::position_mask(std::size_t position, std::size_t letter) const {
+    return std::span(position_masks_).subspan((position * letter_count + letter) * block_count_, block_count_);
+}
+
+template <std::size_t N>
+std::span<const typename BasicCandidateIndex<N>::Block> BasicCandidateIndex<N>::at_least_mask(std::size_t letter, std::size_t count) const {
+    return std::span(at_least_masks_).subspan((letter * N + count - 1) * block_count_, block_count_);
+}
+
+template <std::size_t N>
+void BasicCandidateIndex<N>::reset() {
+    live_ = full_;
+}
+
+// Same rules as score(): a letter in the right place is VALID, otherwise it is VALID_WRONG_PLACE when the answer
+// has at least as many copies of it as the guess, and INVALID when it has fewer.
+template <std::size_t N>
+void BasicCandidateIndex<N>::apply(PackedWord guess, FeedbackOf<N> feedback) {
+    const auto validity = decode_feedback<N>(feedback);
+
+    for (std::size_t i = 0; i < N; i++) {
+        const auto letter = letter_at(guess, i);
+        assert(letter < letter_count);
+
+        const auto in_place = position_mask(i, letter);
+        if (validity[i] == LetterValidity::VALID) {
+            for (std::size_t b = 0; b < block_count_; b++) {
+                live_[b] &= in_place[b];
+            }
+            continue;
+        }
+
+        std::size_t in_guess = 0;
+        for (std::size_t j = 0; j < N; j++) {
+            in_guess += letter_at(guess, j) == letter ? 1 : 0;
+        }
+
+        const auto enough = at_least_mask(letter, in_guess);
+        const Block enough_flip = validity[i] == LetterValidity::VALID_WRONG_PLACE ? 0 : ~Block{0};
+        for (std::size_t b = 0; b < block_count_; b++) {
+            live_[b] &= ~in_place[b] & (enough[b] ^ enough_flip);
+        }
+    }
+}
+
+template <std::size_t N>
+std::size_t BasicCandidateIndex<N>::count() const {
+    std::size_t result = 0;
+    for (const auto block : live_) {
+        result += static_cast<std::size_t>(std::popcount(block));
+    }
+    return result;
+}
+
+template <std::size_t N>
+std::size_t BasicCandidateIndex<N>::first_candidates(std::span<std::uint32_t> out) const {
+    std::size_t written = 0;
+    for (std::size_t b = 0; b < block_count_ && written < out.size(); b++) {
+        for (auto block = live_[b]; block != 0 && written < out.size(); block &= block - 1) {
+            out[written++] = static_cast<std::uint32_t>(b * 64 + static_cast<std::size_t>(std::countr_zero(block)));
+        }
+    }
+    return written;
+}
+
+template class BasicCandidateIndex<4>;
+template class BasicCandidateIndex<5>;
+template class BasicCandidateIndex<6>;
+template class BasicCandidateIndex<7>;
+template class BasicCandidateIndex<8>;
+
+}; // namespace wordle
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "scoring.hpp"
+
+namespace wordle {
+
+// Answers that are still possible, as a bitset over the answer list. Narrowing only ANDs precomputed masks:
+// one per (position, letter) and one per (letter, minimum count), which is exactly what feedback depends on.
+template <std::size_t N>
+class BasicCandidateIndex {
+  public:
+    explicit BasicCandidateIndex(std::span<const PackedWord> answers);
+
+    // Every answer becomes possible again
+    void reset();
+
+    // Keeps only the answers that would have given this feedback for this guess
+    void apply(PackedWord guess, FeedbackOf<N> feedback);
+
+    [[nodiscard]] std::size_t count() const;
+    [[nodiscard]] bool contains(std::size_t answer) const { return (live_[answer / 64] >> (answer % 64)) & 1; }
+
+    // Up to out.size() remaining answers in list order, returns how many were written
+    std::size_t first_candidates(std::span<std::uint32_t> out) const;
+
+  private:
+    using Block = std::uint64_t;
+
+    [[nodiscard]] std::span<const Block> position_mask(std::size_t position, std::size_t letter) const;
+    [[nodiscard]] std::span<const Block> at_least_mask(std::size_t letter, std::size_t count) const;
+
+    std::size_t answer_count_;
+    std::size_t block_count_;
+    std::vector<Block> live_;
+    std::vector<Block> full_;
+    std::vector<Block> position_masks_; // [position][letter][block]
+    std::vector<Block> at_least_masks_; // [letter][count - 1][block]
+};
+
+using CandidateIndex = BasicCandidateIndex<word_length>;
+
+}; // namespace wordle
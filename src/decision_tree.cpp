@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <bit>
+
+#include "decision_tree.hpp"
+#include "solver.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+namespace {
+// The counts of the header are the node count and 0
+constexpr std::array<char, 8> file_magic = {'W', 'O', 'R', 'D', 'L', 'E', 'D', 'T'};
+
+// Answers grouped by the feedback they give to the guess of this row, with a counting sort.
+// The group for feedback f is grouped[offsets[f]] up to grouped[offsets[f + 1]].
+template <std::size_t N>
+void partition(std::span<const FeedbackOf<N>> row, std::span<const std::uint32_t> answers, std::vector<std::uint32_t>& grouped,
+               std::vector<std::uint32_t>& offsets) {
+    offsets.assign(WordTraits<N>::feedback_patterns + 1, 0);
+    for (const auto answer : answers) {
+        offsets[row[answer] + 1U]++;
+    }
+    for (std::size_t f = 1; f < offsets.size(); f++) {
+        offsets[f] += offsets[f - 1];
+    }
+
+    grouped.resize(answers.size());
+    auto next = offsets;
+    for (const auto answer : answers) {
+        grouped[next[row[answer]]++] = answer;
+    }
+}
+
+template <std::size_t N>
+class TreeBuilder {
+  public:
+    using Node = typename BasicDecisionTree<N>::Node;
+
+    explicit TreeBuilder(BasicFeedbackMatrix<N> const& matrix) : matrix_(matrix), solver_(matrix) {}
+
+    // A lone answer is guessed straight away, answer i being guess i
+    std::size_t choose(std::span<const std::uint32_t> answers) {
+        if (answers.size() == 1) {
+            return answers.front();
+        }
+        solver_.assign(answers);
+        return solver_.best_guess().guess;
+    }
+
+    // Fills nodes[index] for these answers and appends everything below it. Children are reserved as one block first,
+    // so that they end up next to each other.
+    void expand(std::vector<Node>& nodes, std::uint32_t index, std::span<const std::uint32_t> answers, std::size_t guess) {
+        std::vector<std::uint32_t> grouped;
+        std::vector<std::uint32_t> offsets;
+        partition<N>(matrix_.row(guess), answers, grouped, offsets);
+
+        Node node{static_cast<std::uint32_t>(guess), static_cast<std::uint32_t>(nodes.size()), {}};
+        std::size_t child_count = 0;
+        for (std::size_t f = 0; f < WordTraits<N>::feedback_patterns; f++) {
+            if (offsets[f + 1] != offsets[f] && f != WordTraits<N>::all_valid_feedback) {
+                node.present[f / 64] |= std::uint64_t{1} << (f % 64);
+                child_count++;
+            }
+        }
+        nodes[index] = node;
+        nodes.resize(nodes.size() + child_count);
+
+        auto child = node.first_child;
+        for (std::size_t f = 0; f < WordTraits<N>::feedback_patterns; f++) {
+            if ((node.present[f / 64] >> (f % 64)) & 1) {
+                const auto group = std::span(grouped).subspan(offsets[f], offsets[f + 1] - offsets[f]);
+                expand(nodes, child++, group, choose(group));
+            }
+        }
+    }
+
+  private:
+    BasicFeedbackMatrix<N> const& matrix_;
+    BasicSolver<N> solver_;
+};
+} // namespace
+
+template <std::size_t N>
+BasicDecisionTree<N> BasicDecisionTree<N>::build(BasicFeedbackMatrix<N> const& matrix, std::size_t opener, ThreadPool& pool) {
+    WORDLE_TRACE_SCOPE("build_decision_tree");
+
+    std::vector<std::uint32_t> answers(matrix.answer_count());
+    for (std::size_t i = 0; i < answers.size(); i++) {
+        answers[i] = static_cast<std::uint32_t>(i);
+    }
+
+    // Same layout as TreeBuilder::expand, except that every group below the opener is built on its own
+    std::vector<Node> nodes(1, Node{static_cast<std::uint32_t>(opener), 1, {}});
+
+    std::vector<std::uint32_t> grouped;
+    std::vector<std::uint32_t> offsets;
+    partition<N>(matrix.row(opener), answers, grouped, offsets);
+
+    std::vector<std::span<const std::uint32_t>> groups;
+    for (std::size_t f = 0; f < WordTraits<N>::feedback_patterns; f++) {
+        if (offsets[f + 1] != offsets[f] && f != WordTraits<N>::all_valid_feedback) {
+            nodes[root].present[f / 64] |= std::uint64_t{1} << (f % 64);
+            groups.push_back(std::span(grouped).subspan(offsets[f], offsets[f + 1] - offsets[f]));
+        }
+    }
+    nodes.resize(1 + groups.size());
+
+    std::vector<std::vector<Node>> subtrees(groups.size());
+    pool.parallel_for(groups.size(), 1, [&](std::size_t first, std::size_t last) {
+        TreeBuilder<N> builder(matrix);
+        for (std::size_t g = first; g < last; g++) {
+            subtrees[g].resize(1);
+            builder.expand(subtrees[g], 0, groups[g], builder.choose(groups[g]));
+        }
+    });
+
+    // Subtree node j > 0 lands at base + j - 1, its root goes in the block reserved below the opener
+    for (std::size_t g = 0; g < subtrees.size(); g++) {
+        const auto base = static_cast<std::uint32_t>(nodes.size());
+        for (auto& node : subtrees[g]) {
+            node.first_child += base - 1;
+        }
+        nodes[1 + g] = subtrees[g].front();
+        nodes.insert(nodes.end(), subtrees[g].begin() + 1, subtrees[g].end());
+    }
+
+    BasicDecisionTree tree;
+    tree.key_ = matrix.key();
+    tree.owned_ = std::move(nodes);
+    tree.nodes_ = tree.owned_.data();
+    tree.node_count_ = tree.owned_.size();
+    return tree;
+}
+
+template <std::size_t N>
+std::optional<std::uint32_t> BasicDecisionTree<N>::child(std::uint32_t node, Feedback feedback) const {
+    auto const& present = nodes_[node].present;
+    const auto word = feedback / 64U;
+    const auto bit = feedback % 64U;
+    if (((present[word] >> bit) & 1) == 0) {
+        return {};
+    }
+
+    auto rank = static_cast<std::uint32_t>(std::popcount(present[word] & ((std::uint64_t{1} << bit) - 1)));
+    for (std::size_t w = 0; w < word; w++) {
+        rank += static_cast<std::uint32_t>(std::popcount(present[w]));
+    }
+    return nodes_[node].first_child + rank;
+}
+
+template <std::size_t N>
+std::optional<BasicDecisionTree<N>> BasicDecisionTree<N>::load(std::filesystem::path const& path, std::span<const PackedWord> guesses,
+                                                               std::span<const PackedWord> answers) {
+    auto cache = open_cache(path, {file_magic, file_version, static_cast<std::uint32_t>(N), word_lists_key(guesses, answers), {}});
+    if (not cache || cache->header.counts[0] == 0 || cache->records().size() != std::size_t{cache->header.counts[0]} * sizeof(Node)) {
+        return {};
+    }
+
+    BasicDecisionTree tree;
+    tree.node_count_ = cache->header.counts[0];
+    tree.key_ = cache->header.key;
+    tree.file_ = std::move(cache->file);
+    tree.nodes_ = reinterpret_cast<const Node*>(tree.file_.bytes().data() + sizeof(CacheHeader));
+    return tree;
+}
+
+template <std::size_t N>
+bool BasicDecisionTree<N>::save(std::filesystem::path const& path) const {
+    const CacheHeader header = {file_magic, file_version, static_cast<std::uint32_t>(N), key_, {static_cast<std::uint32_t>(node_count_), 0}};
+    return write_cache(path, header, std::as_bytes(std::span(nodes_, node_count_)));
+}
+
+template class BasicDecisionTree<4>;
+template class BasicDecisionTree<5>;
+template class BasicDecisionTree<6>;
+template class BasicDecisionTree<7>;
+template class BasicDecisionTree<8>;
+
+}; // namespace wordle
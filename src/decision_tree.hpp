@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "feedback_matrix.hpp"
+#include "mapped_file.hpp"
+#include "scoring.hpp"
+#include "thread_pool.hpp"
+
+namespace wordle {
+
+// What to guess next for every reachable game, as a flat array of nodes. Node 0 is the opener. The children of a node
+// are stored next to each other, one per feedback that can happen, in feedback order: the child for a feedback is
+// first_child plus the number of present feedback below it. Playing a move is a couple of popcounts.
+template <std::size_t N>
+class BasicDecisionTree {
+  public:
+    using Feedback = FeedbackOf<N>;
+
+    static constexpr std::uint32_t file_version = 1;
+    static constexpr std::size_t mask_words = (WordTraits<N>::feedback_patterns + 63) / 64;
+
+    struct Node {
+        std::uint32_t guess;                        // index in the guess list
+        std::uint32_t first_child;                  // meaningless without children
+        std::array<std::uint64_t, mask_words> present; // one bit per feedback that has a child
+    };
+
+    // Greedy entropy tree, same choices as the solver, starting from the given opener. Every subtree of the opener
+    // is built as a task on the pool.
+    static BasicDecisionTree build(BasicFeedbackMatrix<N> const& matrix, std::size_t opener, ThreadPool& pool);
+
+    // Maps the file if it was built from these exact word lists, returns nothing otherwise.
+    static std::optional<BasicDecisionTree> load(std::filesystem::path const& path, std::span<const PackedWord> guesses, std::span<const PackedWord> answers);
+
+    bool save(std::filesystem::path const& path) const;
+
+    static constexpr std::uint32_t root = 0;
+
+    [[nodiscard]] std::size_t guess(std::uint32_t node) const { return nodes_[node].guess; }
+
+    // Node to play after this feedback, nothing if the game is won or the feedback can't happen
+    [[nodiscard]] std::optional<std::uint32_t> child(std::uint32_t node, Feedback feedback) const;
+
+    [[nodiscard]] std::size_t node_count() const { return node_count_; }
+    [[nodiscard]] std::size_t byte_size() const { return node_count_ * sizeof(Node); }
+
+  private:
+    BasicDecisionTree() = default;
+
+    const Node* nodes_ = nullptr;
+    std::size_t node_count_ = 0;
+    std::uint64_t key_ = 0;
+
+    MappedFile file_;
+    std::vector<Node> owned_;
+};
+
+using DecisionTree = BasicDecisionTree<word_length>;
+
+}; // namespace wordle
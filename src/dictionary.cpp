@@ -0,0 +1,94 @@
+#include <cassert>
+
+#include "dictionary.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+namespace {
+template <std::size_t N>
+constexpr std::size_t word_code_count() {
+    std::size_t count = 1;
+    for (std::size_t i = 0; i < N; i++) {
+        count *= 26;
+    }
+    return count;
+}
+
+// Letters as a base 26 number, 26^5 codes is about 1.5 MB of bitset
+template <std::size_t N>
+constexpr std::size_t word_code(PackedWord word) {
+    std::size_t code = 0;
+    for (std::size_t i = N; i-- > 0;) {
+        code = code * 26 + (((word >> (8 * i)) & 0xFF) - 'A');
+    }
+    return code;
+}
+} // namespace
+
+template <std::size_t N>
+BasicDictionary<N>::BasicDictionary(std::vector<PackedWord> words) : words_(std::move(words)) {
+    WORDLE_TRACE_SCOPE("build_dictionary");
+
+    if constexpr (uses_bitset) {
+        members_.resize((word_code_count<N>() + 63) / 64);
+        for (const auto word : words_) {
+            const auto code = word_code<N>(word);
+            assert(code < word_code_count<N>());
+            members_[code / 64] |= std::uint64_t{1} << (code % 64);
+        }
+    } else {
+        // At most half full so probes stay short
+        std::size_t slot_count = 16;
+        hash_shift_ = 60;
+        while (slot_count < 2 * words_.size()) {
+            slot_count *= 2;
+            hash_shift_--;
+        }
+        members_.resize(slot_count);
+
+        for (const auto word : words_) {
+            auto slot = hash_slot(word, hash_shift_);
+            while (members_[slot] != 0 && members_[slot] != word) {
+                slot = (slot + 1) & (slot_count - 1);
+            }
+            members_[slot] = word;
+        }
+    }
+}
+
+template <std::size_t N>
+bool BasicDictionary<N>::contains(PackedWord word) const {
+    if constexpr (uses_bitset) {
+        if ((word >> (8 * N)) != 0) {
+            return false;
+        }
+        for (std::size_t i = 0; i < N; i++) {
+            const auto letter = (word >> (8 * i)) & 0xFF;
+            if (letter < 'A' || letter > 'Z') {
+                return false;
+            }
+        }
+
+        const auto code = word_code<N>(word);
+        return (members_[code / 64] >> (code % 64)) & 1;
+    } else {
+        if (word == 0 || members_.empty()) {
+            return false;
+        }
+        for (auto slot = hash_slot(word, hash_shift_); members_[slot] != 0; slot = (slot + 1) & (members_.size() - 1)) {
+            if (members_[slot] == word) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+template class BasicDictionary<4>;
+template class BasicDictionary<5>;
+template class BasicDictionary<6>;
+template class BasicDictionary<7>;
+template class BasicDictionary<8>;
+
+}; // namespace wordle
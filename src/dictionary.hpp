@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "scoring.hpp"
+
+namespace wordle {
+
+// Packed words of N letters plus a membership index. Up to 5 letters that is a bitset over every possible word,
+// so membership is a single bit test. Past that the bitset gets too big (26^6 bits is 38 MB) and an open addressing
+// hash table of the packed words is used instead.
+template <std::size_t N>
+class BasicDictionary {
+  public:
+    static constexpr bool uses_bitset = N <= 5;
+
+    BasicDictionary() = default;
+    explicit BasicDictionary(std::vector<PackedWord> words);
+
+    // Only meaningful for words of N letters
+    [[nodiscard]] bool contains(PackedWord word) const;
+
+    [[nodiscard]] std::span<const PackedWord> words() const { return words_; }
+    [[nodiscard]] std::size_t size() const { return words_.size(); }
+    [[nodiscard]] bool empty() const { return words_.empty(); }
+    [[nodiscard]] PackedWord operator[](std::size_t i) const { return words_[i]; }
+    [[nodiscard]] auto begin() const { return words_.begin(); }
+    [[nodiscard]] auto end() const { return words_.end(); }
+
+  private:
+    std::vector<PackedWord> words_;
+    std::vector<std::uint64_t> members_; // bitset: one bit per base 26 word code, hash table: the words, 0 for empty slots
+    unsigned hash_shift_ = 0;
+};
+
+using Dictionary = BasicDictionary<word_length>;
+
+// Fibonacci hashing for the open addressing tables of words, the top 64 - shift bits of the product pick the slot
+constexpr std::size_t hash_slot(PackedWord word, unsigned shift) {
+    return static_cast<std::size_t>((word * 0x9E3779B97F4A7C15ULL) >> shift);
+}
+
+}; // namespace wordle
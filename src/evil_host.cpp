@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <cassert>
+
+#include "evil_host.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+namespace {
+// How much a feedback tells the player, a green counts twice as much as a yellow
+template <std::size_t N>
+std::uint32_t revealed(FeedbackOf<N> feedback) {
+    std::uint32_t result = 0;
+    for (std::size_t i = 0; i < N; i++) {
+        result += feedback % 3U;
+        feedback = static_cast<FeedbackOf<N>>(feedback / 3);
+    }
+    return result;
+}
+} // namespace
+
+template <std::size_t N>
+BasicEvilHost<N>::BasicEvilHost(std::span<const PackedWord> answers)
+    : answers_(answers), remaining_(answers.size()), partitioned_(answers.size()), feedback_(answers.size()) {
+    reset();
+}
+
+template <std::size_t N>
+void BasicEvilHost<N>::reset() {
+    remaining_.resize(answers_.size());
+    for (std::size_t i = 0; i < remaining_.size(); i++) {
+        remaining_[i] = static_cast<std::uint32_t>(i);
+    }
+}
+
+template <std::size_t N>
+void BasicEvilHost<N>::apply(PackedWord guess, Feedback feedback) {
+    std::erase_if(remaining_, [&](std::uint32_t answer) { return score<N>(answers_[answer], guess) != feedback; });
+}
+
+// Counting sort over the feedback: one pass to score and count, one to scatter. Nothing is allocated, every buffer
+// is sized for the whole answer list up front.
+template <std::size_t N>
+PackedWord BasicEvilHost<N>::submit(PackedWord guess) {
+    WORDLE_TRACE_SCOPE("evil_host_submit");
+    assert(not remaining_.empty());
+
+    offsets_.fill(0);
+    for (std::size_t i = 0; i < remaining_.size(); i++) {
+        feedback_[i] = score<N>(answers_[remaining_[i]], guess);
+        offsets_[feedback_[i] + 1U]++;
+    }
+
+    Feedback kept = 0;
+    for (std::size_t pattern = 1; pattern < WordTraits<N>::feedback_patterns; pattern++) {
+        const auto count = offsets_[pattern + 1];
+        const auto best = offsets_[kept + 1U];
+        if (count > best || (count == best && revealed<N>(static_cast<Feedback>(pattern)) < revealed<N>(kept))) {
+            kept = static_cast<Feedback>(pattern);
+        }
+    }
+
+    for (std::size_t pattern = 1; pattern < offsets_.size(); pattern++) {
+        offsets_[pattern] += offsets_[pattern - 1];
+    }
+    const auto first = offsets_[kept];
+    const auto last = offsets_[kept + 1U];
+
+    for (std::size_t i = 0; i < remaining_.size(); i++) {
+        partitioned_[offsets_[feedback_[i]]++] = remaining_[i];
+    }
+
+    std::copy(partitioned_.begin() + first, partitioned_.begin() + last, remaining_.begin());
+    remaining_.resize(last - first);
+
+    return answers_[remaining_.front()];
+}
+
+template class BasicEvilHost<4>;
+template class BasicEvilHost<5>;
+template class BasicEvilHost<6>;
+template class BasicEvilHost<7>;
+template class BasicEvilHost<8>;
+
+}; // namespace wordle
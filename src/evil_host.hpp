@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "scoring.hpp"
+
+namespace wordle {
+
+// Absurdle style host that never commits to an answer. Each guess splits the remaining answers by the feedback they
+// would give, and the host keeps the biggest group. Answers are indices in the answer list.
+template <std::size_t N>
+class BasicEvilHost {
+  public:
+    using Feedback = FeedbackOf<N>;
+
+    explicit BasicEvilHost(std::span<const PackedWord> answers);
+
+    // Every answer becomes possible again
+    void reset();
+
+    // Keeps only the answers that would have given this feedback, to follow a game played by an honest host
+    void apply(PackedWord guess, Feedback feedback);
+
+    // Keeps the biggest group of answers that share a feedback for this guess and returns one of them, any of them
+    // gives the same feedback to every guess so far. Ties go to the feedback that tells the player the least.
+    PackedWord submit(PackedWord guess);
+
+    [[nodiscard]] std::span<const std::uint32_t> remaining() const { return remaining_; }
+
+  private:
+    std::span<const PackedWord> answers_;
+    std::vector<std::uint32_t> remaining_;
+    std::vector<std::uint32_t> partitioned_; // remaining answers grouped by feedback, in list order within a group
+    std::vector<Feedback> feedback_;         // feedback of remaining_[i]
+    std::array<std::uint32_t, WordTraits<N>::feedback_patterns + 1> offsets_{};
+};
+
+using EvilHost = BasicEvilHost<word_length>;
+
+}; // namespace wordle
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <fmt/core.h>
+
+#include "feedback_matrix.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+namespace {
+// The counts of the header are the guess count and the answer count
+constexpr std::array<char, 8> file_magic = {'W', 'O', 'R', 'D', 'L', 'E', 'F', 'M'};
+
+void fnv1a(std::uint64_t& hash, std::uint64_t value) {
+    for (std::size_t i = 0; i < sizeof(value); i++) {
+        hash ^= (value >> (8 * i)) & 0xFF;
+        hash *= 0x100000001B3ULL;
+    }
+}
+} // namespace
+
+std::uint64_t word_lists_key(std::span<const PackedWord> guesses, std::span<const PackedWord> answers) {
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    fnv1a(hash, guesses.size());
+    for (const auto word : guesses) {
+        fnv1a(hash, word);
+    }
+    fnv1a(hash, answers.size());
+    for (const auto word : answers) {
+        fnv1a(hash, word);
+    }
+    return hash;
+}
+
+template <std::size_t N>
+BasicFeedbackMatrix<N> BasicFeedbackMatrix<N>::build(std::span<const PackedWord> guesses, std::span<const PackedWord> answers) {
+    WORDLE_TRACE_SCOPE("build_feedback_matrix");
+
+    BasicFeedbackMatrix matrix;
+    matrix.guess_count_ = guesses.size();
+    matrix.answer_count_ = answers.size();
+    matrix.key_ = word_lists_key(guesses, answers);
+    matrix.owned_.resize(guesses.size() * answers.size());
+    matrix.data_ = matrix.owned_.data();
+
+    // Rows are handed out in small blocks so that every thread stays busy until the end
+    constexpr std::size_t rows_per_block = 64;
+    std::atomic<std::size_t> next_row = 0;
+
+    auto worker = [&]() {
+        for (;;) {
+            const auto first = next_row.fetch_add(rows_per_block, std::memory_order_relaxed);
+            if (first >= guesses.size()) {
+                return;
+            }
+            const auto last = std::min(first + rows_per_block, guesses.size());
+            for (std::size_t g = first; g < last; g++) {
+                score_batch<N>(guesses[g], answers, std::span(matrix.owned_).subspan(g * answers.size(), answers.size()));
+            }
+        }
+    };
+
+    const auto thread_count = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count - 1);
+    for (unsigned i = 1; i < thread_count; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    return matrix;
+}
+
+template <std::size_t N>
+std::optional<BasicFeedbackMatrix<N>> BasicFeedbackMatrix<N>::load(std::filesystem::path const& path, std::span<const PackedWord> guesses,
+                                                                   std::span<const PackedWord> answers) {
+    WORDLE_TRACE_SCOPE("load_feedback_matrix");
+
+    auto cache = open_cache(path, {file_magic, file_version, static_cast<std::uint32_t>(N), word_lists_key(guesses, answers), {}});
+    if (not cache || cache->header.counts[0] != guesses.size() || cache->header.counts[1] != answers.size() ||
+        cache->records().size() != guesses.size() * answers.size() * sizeof(Feedback)) {
+        return {};
+    }
+
+    BasicFeedbackMatrix matrix;
+    matrix.guess_count_ = guesses.size();
+    matrix.answer_count_ = answers.size();
+    matrix.key_ = cache->header.key;
+    matrix.file_ = std::move(cache->file);
+    matrix.data_ = reinterpret_cast<const Feedback*>(matrix.file_.bytes().data() + sizeof(CacheHeader));
+    return matrix;
+}
+
+template <std::size_t N>
+bool BasicFeedbackMatrix<N>::save(std::filesystem::path const& path) const {
+    const CacheHeader header = {
+        file_magic, file_version, static_cast<std::uint32_t>(N), key_, {static_cast<std::uint32_t>(guess_count_), static_cast<std::uint32_t>(answer_count_)}};
+    return write_cache(path, header, std::as_bytes(std::span(data_, guess_count_ * answer_count_)));
+}
+
+template <std::size_t N>
+BasicFeedbackMatrix<N> BasicFeedbackMatrix<N>::load_or_build(std::filesystem::path const& path, std::span<const PackedWord> guesses,
+                                                              std::span<const PackedWord> answers) {
+    if (auto cached = load(path, guesses, answers)) {
+        return std::move(*cached);
+    }
+
+    auto matrix = build(guesses, answers);
+    if (not matrix.save(path)) {
+        fmt::print("[WARNING] Couldn't write feedback matrix cache to {}\n", path.string());
+        return matrix;
+    }
+
+    // Prefer the mapping over the heap copy, pages are shared with every other process using the cache
+    if (auto cached = load(path, guesses, answers)) {
+        return std::move(*cached);
+    }
+    return matrix;
+}
+
+template class BasicFeedbackMatrix<4>;
+template class BasicFeedbackMatrix<5>;
+template class BasicFeedbackMatrix<6>;
+template class BasicFeedbackMatrix<7>;
+template class BasicFeedbackMatrix<8>;
+
+}; // namespace wordle
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "mapped_file.hpp"
+#include "scoring.hpp"
+
+namespace wordle {
+
+// Every guess scored against every answer, row major: one row per guess.
+template <std::size_t N>
+class BasicFeedbackMatrix {
+  public:
+    using Feedback = FeedbackOf<N>;
+
+    static constexpr std::uint32_t file_version = 1;
+
+    // Builds the table on every core.
+    static BasicFeedbackMatrix build(std::span<const PackedWord> guesses, std::span<const PackedWord> answers);
+
+    // Maps the cache file if it was built from these exact word lists, returns nothing otherwise.
+    static std::optional<BasicFeedbackMatrix> load(std::filesystem::path const& path, std::span<const PackedWord> guesses, std::span<const PackedWord> answers);
+
+    // Maps the cache file, or builds the table and writes the cache for next time.
+    static BasicFeedbackMatrix load_or_build(std::filesystem::path const& path, std::span<const PackedWord> guesses, std::span<const PackedWord> answers);
+
+    bool save(std::filesystem::path const& path) const;
+
+    [[nodiscard]] Feedback at(std::size_t guess, std::size_t answer) const { return data_[guess * answer_count_ + answer]; }
+    [[nodiscard]] std::span<const Feedback> row(std::size_t guess) const { return {data_ + guess * answer_count_, answer_count_}; }
+
+    [[nodiscard]] std::size_t guess_count() const { return guess_count_; }
+    [[nodiscard]] std::size_t answer_count() const { return answer_count_; }
+    [[nodiscard]] bool is_mapped() const { return owned_.empty(); }
+
+    // word_lists_key of the lists it was built from
+    [[nodiscard]] std::uint64_t key() const { return key_; }
+
+  private:
+    BasicFeedbackMatrix() = default;
+
+    const Feedback* data_ = nullptr;
+    std::size_t guess_count_ = 0;
+    std::size_t answer_count_ = 0;
+    std::uint64_t key_ = 0;
+
+    MappedFile file_;
+    std::vector<Feedback> owned_;
+};
+
+using FeedbackMatrix = BasicFeedbackMatrix<word_length>;
+
+// FNV-1a over both word lists, identifies which lists a cache file was built from
+std::uint64_t word_lists_key(std::span<const PackedWord> guesses, std::span<const PackedWord> answers);
+
+}; // namespace wordle
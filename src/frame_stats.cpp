@@ -0,0 +1,36 @@
+#include <algorithm>
+#include <vector>
+
+#include "frame_stats.hpp"
+
+namespace wordle {
+
+void FrameStats::record(double frame_ms) {
+    frame_ms_[frame_count_ % window] = static_cast<float>(frame_ms);
+    frame_count_++;
+
+    // Half a frame of slack, vsync intervals jitter a little
+    if (frame_ms > budget_ms_ * 1.5) {
+        missed_frames_++;
+    }
+}
+
+void FrameStats::record_allocations(std::size_t allocations) {
+    if (allocations > 0) {
+        allocating_frames_++;
+    }
+}
+
+double FrameStats::percentile(double p) const {
+    const auto count = std::min(frame_count_, window);
+    if (count == 0) {
+        return 0.0;
+    }
+
+    std::vector<float> sorted(frame_ms_.begin(), frame_ms_.begin() + static_cast<long>(count));
+    const auto index = std::min(count - 1, static_cast<std::size_t>(p * static_cast<double>(count - 1) + 0.5));
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<long>(index), sorted.end());
+    return sorted[index];
+}
+
+}; // namespace wordle
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace wordle {
+
+// Frame times of the last few thousand frames, to check that nothing makes the render loop miss a vsync.
+class FrameStats {
+  public:
+    explicit FrameStats(double budget_ms = 1000.0 / 60.0) : budget_ms_(budget_ms) {}
+
+    void record(double frame_ms);
+
+    // Heap allocations made during a frame that should not have made any
+    void record_allocations(std::size_t allocations);
+
+    // Over the frames still in the window, p in [0, 1]
+    [[nodiscard]] double percentile(double p) const;
+
+    [[nodiscard]] std::size_t frame_count() const { return frame_count_; }
+    [[nodiscard]] std::size_t missed_frames() const { return missed_frames_; }
+    [[nodiscard]] std::size_t allocating_frames() const { return allocating_frames_; }
+    [[nodiscard]] double budget_ms() const { return budget_ms_; }
+
+  private:
+    static constexpr std::size_t window = 4096;
+
+    double budget_ms_;
+    std::array<float, window> frame_ms_{};
+    std::size_t frame_count_ = 0;
+    std::size_t missed_frames_ = 0;
+    std::size_t allocating_frames_ = 0;
+};
+
+}; // namespace wordle
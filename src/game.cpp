@@ -0,0 +1,42 @@
+#include <algorithm>
+#include <cassert>
+#include <ranges>
+
+#include "game.hpp"
+
+namespace wordle {
+
+template <std::size_t N>
+BasicGame<N>::BasicGame(PackedWord answer, std::size_t max_tries) : answer_(answer), max_tries_(std::min(max_tries, max_rows)) {}
+
+template <std::size_t N>
+typename BasicGame<N>::Feedback BasicGame<N>::submit(PackedWord guess) {
+    assert(state_ == GameState::PLAYING);
+
+    const auto result = score<N>(answer_, guess);
+    guesses_[tries_] = guess;
+    feedback_[tries_] = result;
+    tries_++;
+
+    if (result == WordTraits<N>::all_valid_feedback) {
+        state_ = GameState::WON;
+    } else if (tries_ >= max_tries_) {
+        state_ = GameState::LOST;
+    }
+
+    return result;
+}
+
+template <std::size_t N>
+void BasicGame<N>::substitute_answer(PackedWord answer) {
+    assert(std::ranges::all_of(std::views::iota(std::size_t{0}, tries_), [&](std::size_t row) { return score<N>(answer, guesses_[row]) == feedback_[row]; }));
+    answer_ = answer;
+}
+
+template class BasicGame<4>;
+template class BasicGame<5>;
+template class BasicGame<6>;
+template class BasicGame<7>;
+template class BasicGame<8>;
+
+}; // namespace wordle
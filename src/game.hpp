@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+#include "scoring.hpp"
+
+namespace wordle {
+
+enum class GameState { PLAYING, WON, LOST };
+
+// Rules of one game, without any UI: score each submitted row and decide when it is over.
+template <std::size_t N>
+class BasicGame {
+  public:
+    using Feedback = FeedbackOf<N>;
+
+    static constexpr std::size_t max_rows = 6;
+
+    explicit BasicGame(PackedWord answer, std::size_t max_tries = max_rows);
+
+    // Must only be called while PLAYING
+    Feedback submit(PackedWord guess);
+
+    // Swaps the answer for one that gives the same feedback to every guess so far, for hosts that don't commit
+    void substitute_answer(PackedWord answer);
+
+    [[nodiscard]] GameState state() const { return state_; }
+    [[nodiscard]] PackedWord answer() const { return answer_; }
+    [[nodiscard]] std::size_t max_tries() const { return max_tries_; }
+    [[nodiscard]] std::size_t tries() const { return tries_; }
+    [[nodiscard]] std::span<const PackedWord> guesses() const { return std::span(guesses_).first(tries_); }
+    [[nodiscard]] std::span<const Feedback> feedback() const { return std::span(feedback_).first(tries_); }
+
+  private:
+    PackedWord answer_;
+    std::size_t max_tries_;
+    std::size_t tries_ = 0;
+    GameState state_ = GameState::PLAYING;
+    std::array<PackedWord, max_rows> guesses_{};
+    std::array<Feedback, max_rows> feedback_{};
+};
+
+using Game = BasicGame<word_length>;
+
+}; // namespace wordle
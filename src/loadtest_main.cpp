@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "game.hpp"
+#include "protocol.hpp"
+
+namespace {
+struct Options {
+    std::string socket_path = "/tmp/wordle.sock";
+    std::size_t connections = 4;
+    std::size_t sessions = 20000;
+    std::size_t concurrent = 256; // open games per connection
+};
+
+// Valid guesses played in order until the game ends, the first three share no letter. The server is what is measured
+// here, not how well the games are played.
+constexpr std::array<std::string_view, wordle::Game::max_rows> script = {"SOARE", "CLINT", "DUMPY", "BOUGH", "WHACK", "FIZZY"};
+
+struct ConnectionResult {
+    std::size_t sessions = 0;
+    std::vector<double> latencies_us;
+    bool failed = false;
+    std::optional<wordle::ResponseStatus> refused; // why the server wouldn't start a game, if it didn't
+};
+
+int connect_to(std::string const& path) {
+    sockaddr_un address{};
+    if (path.size() >= sizeof(address.sun_path)) {
+        return -1;
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    const auto fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool transfer(int fd, void* data, std::size_t size, bool is_sending) {
+    auto* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        const auto done = is_sending ? send(fd, bytes, size, MSG_NOSIGNAL) : recv(fd, bytes, size, 0);
+        if (done <= 0) {
+            if (done < 0 && errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes += done;
+        size -= static_cast<std::size_t>(done);
+    }
+    return true;
+}
+
+// Plays its share of the sessions, keeping `concurrent` games open at once and moving them forward in turn
+ConnectionResult run_connection(Options const& options, std::size_t quota) {
+    ConnectionResult result;
+    result.latencies_us.reserve(quota * (script.size() + 2));
+
+    const auto fd = connect_to(options.socket_path);
+    if (fd < 0) {
+        result.failed = true;
+        return result;
+    }
+
+    auto call = [&](wordle::Request request) {
+        wordle::Response response{};
+        const auto start = std::chrono::steady_clock::now();
+        if (not transfer(fd, &request, sizeof(request), true) || not transfer(fd, &response, sizeof(response), false)) {
+            result.failed = true;
+        }
+        result.latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        return response;
+    };
+
+    struct Slot {
+        std::uint64_t session = 0;
+        std::size_t guesses = 0;
+        bool is_open = false;
+    };
+    std::vector<Slot> slots(std::max<std::size_t>(1, std::min(options.concurrent, quota)));
+
+    std::size_t started = 0;
+    std::size_t open = 0;
+    while (not result.failed && (started < quota || open > 0)) {
+        for (auto& slot : slots) {
+            if (not slot.is_open) {
+                if (started == quota) {
+                    continue;
+                }
+                const auto response = call({wordle::MessageType::NEW_GAME, {}, 0, 0});
+                if (response.status != wordle::ResponseStatus::OK) {
+                    result.failed = true;
+                    result.refused = response.status;
+                    break;
+                }
+                slot = {response.session, 0, true};
+                started++;
+                open++;
+                continue;
+            }
+
+            const auto response = call({wordle::MessageType::SUBMIT, {}, slot.session, wordle::pack_word(script[slot.guesses++])});
+            if (response.status != wordle::ResponseStatus::OK || response.state != static_cast<std::uint8_t>(wordle::GameState::PLAYING)) {
+                call({wordle::MessageType::CLOSE, {}, slot.session, 0});
+                slot.is_open = false;
+                open--;
+                result.sessions++;
+            }
+        }
+    }
+
+    close(fd);
+    return result;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--socket" && has_value) {
+            options.socket_path = argv[++i];
+        } else if (arg == "--connections" && has_value) {
+            options.connections = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--sessions" && has_value) {
+            options.sessions = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--concurrent" && has_value) {
+            options.concurrent = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            fmt::print("Usage: {} [--socket PATH] [--connections N] [--sessions N] [--concurrent N]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<ConnectionResult> results(options.connections);
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t c = 0; c < options.connections; c++) {
+            const auto quota = options.sessions / options.connections + (c < options.sessions % options.connections ? 1 : 0);
+            threads.emplace_back([&, c, quota]() { results[c] = run_connection(options, quota); });
+        }
+    }
+    const auto elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::size_t sessions = 0;
+    std::vector<double> latencies;
+    for (auto& result : results) {
+        if (result.refused) {
+            fmt::print("[ERROR] {} couldn't start a game: {}\n", options.socket_path, wordle::status_name(*result.refused));
+            return EXIT_FAILURE;
+        }
+        if (result.failed) {
+            fmt::print("[ERROR] A connection to {} failed\n", options.socket_path);
+            return EXIT_FAILURE;
+        }
+        sessions += result.sessions;
+        latencies.insert(latencies.end(), result.latencies_us.begin(), result.latencies_us.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    auto percentile = [&](double p) {
+        if (latencies.empty()) {
+            return 0.0;
+        }
+        return latencies[std::min(latencies.size() - 1, static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1) + 0.5))];
+    };
+
+    fmt::print("{} sessions over {} connections ({} open at once) in {:.3f} s\n", sessions, options.connections, options.connections * options.concurrent,
+               elapsed_s);
+    fmt::print("{:.1f} sessions/s, {:.1f} requests/s\n", static_cast<double>(sessions) / elapsed_s, static_cast<double>(latencies.size()) / elapsed_s);
+    fmt::print("Request latency p50 {:.1f} us, p99 {:.1f} us, max {:.1f} us\n", percentile(0.50), percentile(0.99), percentile(1.0));
+
+    return EXIT_SUCCESS;
+}
@@ -1,11 +1,14 @@
 #include <array>
-#include <cctype>
+#include <chrono>
+#include <cstdlib>
 #include <filesystem>
-#include <fstream>
 #include <iostream>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <fmt/core.h>
@@ -13,132 +16,161 @@
 #include <SDL2/SDL.h>
 #include <SDL_opengl.h>
 
+#include "allocation_counter.hpp"
+#include "analysis_service.hpp"
+#include "candidate_index.hpp"
+#include "decision_tree.hpp"
+#include "evil_host.hpp"
+#include "feedback_matrix.hpp"
+#include "frame_stats.hpp"
+#include "game.hpp"
+#include "render_scheduler.hpp"
+#include "scoring.hpp"
+#include "trace.hpp"
+#include "word_list.hpp"
+
 #include "imgui_misc/imgui_impl_opengl3.h"
 #include "imgui_misc/imgui_impl_sdl.h"
 #include "imgui_misc/imgui_stdlib.h"
 #include <imgui.h>
 
-std::vector<std::string> split(const std::string& s, char delimiter) {
-    std::vector<std::string> tokens;
-    std::string token;
-    std::istringstream tokenStream(s);
-    while (std::getline(tokenStream, token, delimiter)) {
-        tokens.push_back(token);
+namespace {
+struct Options {
+    std::size_t word_length = wordle::word_length;
+    std::filesystem::path answers_path; // the bundled lists when empty
+    std::filesystem::path allowed_path;
+};
+
+// Largest feedback matrix the game builds, 1 GiB. The bundled 5 letter lists need 30 MB. Past that best guesses are off
+// and only the remaining answers are shown.
+constexpr std::size_t max_matrix_bytes = std::size_t{1} << 30;
+
+#ifdef WORDLE_TRACING
+// Live numbers from the tracing counters, to profile without attaching anything. Rates are over the last second.
+class TraceOverlay {
+  public:
+    void frame_done(double frame_ms, std::size_t frame_allocations, std::size_t total_allocations) {
+        last_frame_ms_ = frame_ms;
+        frame_allocations_ = frame_allocations;
+        total_allocations_ = total_allocations;
+        window_max_ms_ = std::max(window_max_ms_, frame_ms);
+
+        const auto now = wordle::trace::now_ns();
+        if (now - window_start_ns_ >= 1'000'000'000) {
+            const auto seconds = static_cast<double>(now - window_start_ns_) / 1e9;
+            const auto score_calls = wordle::trace::value(wordle::trace::Counter::SCORE_CALLS);
+            const auto evaluations = wordle::trace::value(wordle::trace::Counter::ENTROPY_EVALUATIONS);
+            score_calls_per_second_ = static_cast<double>(score_calls - window_score_calls_) / seconds;
+            evaluations_per_second_ = static_cast<double>(evaluations - window_evaluations_) / seconds;
+            max_frame_ms_ = window_max_ms_;
+
+            window_start_ns_ = now;
+            window_score_calls_ = score_calls;
+            window_evaluations_ = evaluations;
+            window_max_ms_ = 0.0;
+        }
     }
-    return tokens;
-}
-
-std::string read_text_file(std::filesystem::path const& path) {
-    const auto size = std::filesystem::file_size(path);
-
-    std::ifstream file(path);
 
-    std::string result;
-    result.resize(size);
-
-    if (not file.read(result.data(), static_cast<long>(size))) {
-        return {};
+    void draw() const {
+        ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+        ImGui::SetNextWindowBgAlpha(0.6f);
+        ImGui::Begin("Trace", nullptr,
+                     ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoFocusOnAppearing |
+                         ImGuiWindowFlags_NoNav);
+        ImGui::Text("Frame %.2f ms, max %.2f ms", last_frame_ms_, max_frame_ms_);
+        ImGui::Text("Scoring %.0f calls/s", score_calls_per_second_);
+        ImGui::Text("Solver %.0f guesses/s", evaluations_per_second_);
+        ImGui::Text("Allocations %zu last frame, %zu total", frame_allocations_, total_allocations_);
+        ImGui::End();
     }
 
-    return result;
-}
-
-namespace wordle {
-enum class LetterValidity { VALID, VALID_WRONG_PLACE, INVALID };
-
-std::vector<LetterValidity> check_validity(std::string const& original, std::string const& submitted) {
-    using enum LetterValidity;
-
-    std::vector<LetterValidity> result(original.size());
-
-    for (std::size_t i = 0; i < original.size(); i++) {
-        if (std::toupper(original[i]) == submitted[i]) {
-            result[i] = VALID;
-        } else {
-            int subCounter = 0;
-            int subOriginal = 0;
-
-            for (std::size_t j = 0; j < original.size(); j++) {
-                if (std::toupper(original[j]) == submitted[i]) {
-                    subOriginal++;
-                }
-                if (submitted[j] == submitted[i]) {
-                    subCounter++;
-                }
-            }
+  private:
+    double last_frame_ms_ = 0.0;
+    double max_frame_ms_ = 0.0;
+    std::size_t frame_allocations_ = 0;
+    std::size_t total_allocations_ = 0;
+    double score_calls_per_second_ = 0.0;
+    double evaluations_per_second_ = 0.0;
+
+    std::uint64_t window_start_ns_ = wordle::trace::now_ns();
+    std::uint64_t window_score_calls_ = 0;
+    std::uint64_t window_evaluations_ = 0;
+    double window_max_ms_ = 0.0;
+};
+#endif
 
-            if (subOriginal > 0 && subCounter <= subOriginal) {
-                result[i] = VALID_WRONG_PLACE;
-            } else {
-                result[i] = INVALID;
-            }
-        }
+// Everything below depends on the word length, which is picked once at startup. Scoring, the dictionary and the
+// hints then all run the code specialized for it.
+template <std::size_t N>
+int play(SDL_Window* window, ImGuiIO& io, Options const& options) {
+    // Leave a core to the render thread: the analysis worker and the loading below sleep while the pool runs their
+    // parallel_for. The word lists are parsed on it too.
+    wordle::ThreadPool analysis_pool(std::max(2U, std::thread::hardware_concurrency()) - 1);
+
+    const bool is_custom = not options.answers_path.empty();
+    const auto load_start = std::chrono::steady_clock::now();
+    const auto word_lists = is_custom ? wordle::load_word_list_files<N>(options.answers_path, options.allowed_path, &analysis_pool)
+                                      : wordle::load_word_lists<N>("assets", &analysis_pool);
+    const auto load_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - load_start);
+
+    if (not word_lists.unreadable_file.empty()) {
+        fmt::print("[ERROR] Couldn't read the word list {}\n", word_lists.unreadable_file.string());
+        return EXIT_FAILURE;
+    }
+    if (word_lists.answers.empty()) {
+        fmt::print("[ERROR] No {} letter answers in {}\n", N, is_custom ? options.answers_path.string() : std::string("assets/"));
+        return EXIT_FAILURE;
     }
 
-    return result;
-}
-
-}; // namespace wordle
-
-int main() {
-    const auto wordle_answers = []() {
-        const auto wordle_answers_raw = read_text_file("assets/wordle-answers-alphabetical.txt");
-        return split(wordle_answers_raw, '\n');
-    }();
-
-    const auto wordle_guesses = []() {
-        const auto wordle_guesses_raw = read_text_file("assets/wordle-allowed-guesses.txt");
-        auto splitted = split(wordle_guesses_raw, '\n');
-        std::sort(splitted.begin(), splitted.end());
-        return splitted;
-    }();
-
+    // Frequency lists make common words come up more often
     std::random_device rd;
     std::minstd_rand rand(rd());
-    std::uniform_int_distribution<std::size_t> random_answer(0, wordle_answers.size());
+    std::uniform_int_distribution<std::size_t> uniform_answer(0, word_lists.answers.size() - 1);
+    std::discrete_distribution<std::size_t> weighted_answer(word_lists.answer_weights.begin(), word_lists.answer_weights.end());
+    auto random_answer = [&]() { return word_lists.answer_weights.empty() ? uniform_answer(rand) : weighted_answer(rand); };
 
     fmt::print("Wordle!\n");
-
-    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
-        fmt::print("[ERROR] Couldn't load SDL : {}\n", SDL_GetError());
-        return EXIT_FAILURE;
+    fmt::print("Loaded {} letter words: {} answers and {} allowed guesses in {} us{}\n", N, word_lists.answers.size(), word_lists.guesses.size(),
+               load_time.count(), word_lists.answer_weights.empty() ? "" : ", answers weighted by frequency");
+
+    // The matrix, the tree and the analysis service only exist for lists small enough to score every guess against
+    // every answer up front
+    std::optional<wordle::BasicFeedbackMatrix<N>> matrix;
+    std::optional<wordle::BasicDecisionTree<N>> tree;
+    std::optional<wordle::BasicAnalysisService<N>> analysis;
+
+    const auto matrix_bytes = word_lists.guesses.size() * word_lists.answers.size() * sizeof(wordle::FeedbackOf<N>);
+    if (matrix_bytes <= max_matrix_bytes) {
+        // Custom lists get their own cache instead of replacing the one of the bundled lists
+        auto matrix_path = N == wordle::word_length ? std::string("assets/feedback_matrix.bin") : fmt::format("assets/feedback_matrix_{}.bin", N);
+        if (is_custom) {
+            matrix_path = fmt::format("assets/feedback_matrix_{}_{:016x}.bin", N, wordle::word_lists_key(word_lists.guesses.words(), word_lists.answers));
+        }
+        matrix = wordle::BasicFeedbackMatrix<N>::load_or_build(matrix_path, word_lists.guesses.words(), word_lists.answers);
+
+        // Built offline by wordle_tree, hints come straight from it while the player follows it
+        const auto tree_path = N == wordle::word_length ? std::string("assets/decision_tree.bin") : fmt::format("assets/decision_tree_{}.bin", N);
+        tree = wordle::BasicDecisionTree<N>::load(tree_path, word_lists.guesses.words(), word_lists.answers);
+
+        // Results wake the render loop up, SDL_PushEvent is thread safe
+        analysis.emplace(*matrix, word_lists.guesses.words(), word_lists.answer_weights, analysis_pool, []() {
+            SDL_Event wake{};
+            wake.type = SDL_USEREVENT;
+            SDL_PushEvent(&wake);
+        });
+    } else {
+        fmt::print("[WARNING] The feedback matrix of these lists would take {} MB, over the {} MB limit: best guesses are off\n", matrix_bytes >> 20,
+                   max_matrix_bytes >> 20);
     }
 
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, 0);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 6);
-
-    SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
-    SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 23);
-    SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
-
-    const auto window_flags = static_cast<SDL_WindowFlags>(SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
-    SDL_Window* window = SDL_CreateWindow("Wordle", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 800, 600, window_flags);
-
-    SDL_GLContext gl_context = SDL_GL_CreateContext(window);
-    SDL_GL_MakeCurrent(window, gl_context);
-    SDL_GL_SetSwapInterval(1); // Enable VSYNC
-
-    IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
-    ImGuiIO& io = ImGui::GetIO();
-
-    io.Fonts->AddFontFromFileTTF("assets/liberation_font/LiberationSans-Bold.ttf", 16);
-
-    ImGui::StyleColorsDark();
-
-    ImGui_ImplSDL2_InitForOpenGL(window, gl_context);
-    const char* glsl_version = "#version 450";
-    ImGui_ImplOpenGL3_Init(glsl_version);
-
     ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 
-    std::string word_to_guess = "wordle"; // wordle_answers[random_answer(rand)];
+    std::string word_to_guess = wordle::unpack_word(word_lists.answers[random_answer()]);
 
     enum class Status { UNKNOWN, VALID, WRONG_POSITION };
 
     std::size_t max_tries = 6;
+    auto game = wordle::BasicGame<N>(wordle::pack_word(word_to_guess), max_tries);
     std::size_t tries = 1;
 
     using Inputs = std::vector<std::vector<std::array<char, 2>>>;
@@ -159,24 +191,98 @@ int main() {
 
     std::size_t current_cell = 0;
 
-    enum class GameState { PLAYING, WON, LOST };
+    bool is_not_a_word = false;
+
+    wordle::BasicCandidateIndex<N> candidates(word_lists.answers);
+    std::size_t remaining_count = 0;
+    bool show_hints = false;
+    std::string hint_text;
+
+    // Called right after the candidates change, so the frame that shows the feedback also shows the new count
+    auto refresh_hints = [&]() {
+        remaining_count = candidates.count();
 
-    auto current_game_state = GameState::PLAYING;
+        std::array<std::uint32_t, 12> hints{};
+        const auto hint_count = candidates.first_candidates(hints);
+        hint_text.clear();
+        for (std::size_t i = 0; i < hint_count; i++) {
+            hint_text += wordle::unpack_word(word_lists.answers[hints[i]]);
+            hint_text += i + 1 < hint_count ? " " : (hint_count < remaining_count ? " ..." : "");
+        }
+    };
+    refresh_hints();
+
+    // Follows every game so that it can take over at any point once switched on
+    wordle::BasicEvilHost<N> evil_host(word_lists.answers);
+    bool is_evil = false;
+
+    std::optional<std::uint32_t> tree_node; // where the game is in the tree, nothing once the player left it
+    std::string best_guess_text;
+
+    // A table lookup while the game is in the tree, a search on the analysis service otherwise
+    auto request_best_guess = [&]() {
+        if (not analysis) {
+            best_guess_text = "Best guess: off for lists this big";
+        } else if (tree_node) {
+            analysis->cancel();
+            best_guess_text = fmt::format("Best guess: {}", wordle::unpack_word(word_lists.guesses[tree->guess(*tree_node)]));
+        } else {
+            best_guess_text = "Thinking...";
+            analysis->submit(game.guesses(), game.feedback());
+        }
+    };
+
+    if (tree) {
+        tree_node = wordle::BasicDecisionTree<N>::root;
+    }
+    request_best_guess();
+
+    std::string word_reveal_text = fmt::format("The word was: {}", word_to_guess);
+
+    wordle::FrameStats frame_stats;
+    wordle::RenderScheduler scheduler;
+    std::size_t steady_frames = 0;
+#ifdef WORDLE_TRACING
+    TraceOverlay trace_overlay;
+#endif
 
     bool is_looping = true;
     while (is_looping) { // WEEEEEE
 
+        // Nothing to animate: sleep until something happens instead of redrawing at vsync rate
         SDL_Event event;
-        while (SDL_PollEvent(&event) != 0) {
+        bool has_event = scheduler.is_idle() ? SDL_WaitEventTimeout(&event, scheduler.idle_timeout_ms()) != 0 : SDL_PollEvent(&event) != 0;
+        const bool is_steady_frame = not has_event;
+
+        const auto frame_start = std::chrono::steady_clock::now();
+        const auto frame_allocations = wordle::allocation_count();
+        WORDLE_TRACE_SCOPE("frame");
+
+        for (; has_event; has_event = SDL_PollEvent(&event) != 0) {
+            WORDLE_TRACE_SCOPE("event");
+            scheduler.request_frames();
             ImGui_ImplSDL2_ProcessEvent(&event);
             switch (event.type) {
                 case SDL_QUIT:
                     is_looping = false;
                     break;
                 case SDL_KEYDOWN:
-                    if (current_game_state != GameState::PLAYING) {
-                        current_game_state = GameState::PLAYING;
-                        word_to_guess = wordle_answers[random_answer(rand)];
+                    if (game.state() != wordle::GameState::PLAYING) {
+                        word_to_guess = wordle::unpack_word(word_lists.answers[random_answer()]);
+                        word_reveal_text = fmt::format("The word was: {}", word_to_guess);
+                        game = wordle::BasicGame<N>(wordle::pack_word(word_to_guess), max_tries);
+                        is_not_a_word = false;
+                        candidates.reset();
+                        refresh_hints();
+                        evil_host.reset();
+
+                        if (analysis) {
+                            analysis->cancel();
+                        }
+                        if (tree) {
+                            tree_node = wordle::BasicDecisionTree<N>::root;
+                        }
+                        request_best_guess();
 
                         tries = 1;
                         current_cell = 0;
@@ -206,9 +312,16 @@ int main() {
             }
         }
 
-        ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplSDL2_NewFrame();
-        ImGui::NewFrame();
+        while (const auto result = analysis ? analysis->poll() : std::nullopt) {
+            best_guess_text = fmt::format("Best guess: {} ({:.2f} bits)", wordle::unpack_word(word_lists.guesses[result->guess]), result->entropy);
+        }
+
+        {
+            WORDLE_TRACE_SCOPE("new_frame");
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplSDL2_NewFrame();
+            ImGui::NewFrame();
+        }
 
         ImGui::Begin("Wordle", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoResize);
 
@@ -224,7 +337,7 @@ int main() {
 
         ImGui::SetWindowFontScale(4.f);
 
-        const auto style = ImGui::GetStyle();
+        const auto& style = ImGui::GetStyle();
 
         const auto box_width = ImGui::GetFontSize();
 
@@ -242,17 +355,21 @@ int main() {
 
                 ImGui::SetNextItemWidth(box_width);
 
+                int pushed_colors = 0;
                 switch (status[j][i]) {
                     case wordle::LetterValidity::VALID:
                         ImGui::PushStyleColor(ImGuiCol_FrameBg, green);
                         ImGui::PushStyleColor(ImGuiCol_Text, black);
+                        pushed_colors = 2;
                         break;
                     case wordle::LetterValidity::VALID_WRONG_PLACE:
                         ImGui::PushStyleColor(ImGuiCol_FrameBg, yellow);
                         ImGui::PushStyleColor(ImGuiCol_Text, black);
+                        pushed_colors = 2;
                         break;
                     default:
                         ImGui::PushStyleColor(ImGuiCol_FrameBg, black);
+                        pushed_colors = 1;
                         break;
                 }
 
@@ -260,66 +377,107 @@ int main() {
                 if (j < tries - 1) {
                     flags |= ImGuiInputTextFlags_ReadOnly;
                 }
-                const auto label = fmt::format("##foo{}{}", i, j);
-
-                ImGui::InputText(label.c_str(), inputs[j][i].data(), 2, static_cast<int>(flags));
+                ImGui::PushID(static_cast<int>(j * word_to_guess.size() + i));
+                ImGui::InputText("##cell", inputs[j][i].data(), 2, static_cast<int>(flags));
+                ImGui::PopID();
 
                 if (ImGui::IsItemFocused() && ImGui::IsItemEdited()) {
+                    is_not_a_word = false;
 
                     current_cell++;
                     if (current_cell >= word_to_guess.size()) {
-                        auto submitted = std::string();
-                        submitted.resize(word_to_guess.size());
+                        std::array<char, N> submitted{};
                         for (std::size_t i = 0; i < inputs[j].size(); i++) {
                             submitted[i] = inputs[j][i][0];
                         }
 
-                        status[j] = wordle::check_validity(word_to_guess, submitted);
+                        const auto guess = wordle::pack_word(std::string_view(submitted.data(), submitted.size()));
+                        if (not word_lists.guesses.contains(guess)) {
+                            is_not_a_word = true;
+                            current_cell = 0;
+                            for (auto& cell : inputs[j]) {
+                                cell = std::array<char, 2>();
+                            }
+                        } else {
+                            if (is_evil) {
+                                game.substitute_answer(evil_host.submit(guess));
+                                word_to_guess = wordle::unpack_word(game.answer());
+                                word_reveal_text = fmt::format("The word was: {}", word_to_guess);
+                            }
 
-                        auto counter_valid = 0;
-                        for (auto const& s : status[j]) {
-                            if (s == wordle::LetterValidity::VALID) {
-                                counter_valid++;
+                            const auto feedback = game.submit(guess);
+                            if (not is_evil) {
+                                evil_host.apply(guess, feedback);
                             }
-                        }
 
-                        if (counter_valid == word_to_guess.size()) {
-                            current_game_state = GameState::WON;
-                        } else if (j >= max_tries - 1) {
-                            current_game_state = GameState::LOST;
-                        } else {
-                            tries++;
-                            current_cell = 0;
+                            const auto validity = wordle::decode_feedback<N>(feedback);
+                            status[j].assign(validity.begin(), validity.end());
+
+                            candidates.apply(guess, feedback);
+                            refresh_hints();
+
+                            if (tree_node) {
+                                const bool followed_tree = word_lists.guesses[tree->guess(*tree_node)] == guess;
+                                tree_node = followed_tree ? tree->child(*tree_node, feedback) : std::nullopt;
+                            }
+
+                            if (game.state() == wordle::GameState::PLAYING) {
+                                tries++;
+                                current_cell = 0;
+
+                                request_best_guess();
+                            } else if (analysis) {
+                                analysis->cancel();
+                            }
                         }
                     }
                 }
-                ImGui::PopStyleColor();
+                ImGui::PopStyleColor(pushed_colors);
 
                 ImGui::SameLine();
             }
             ImGui::NewLine();
         }
 
-        static const std::string win_text = "YOU WIN!";
-        static const std::string lost_text = "YOU LOST...";
+        ImGui::SetWindowFontScale(1.5f);
+        ImGui::Text("%zu words remaining", remaining_count);
+        ImGui::Checkbox("Show hints", &show_hints);
+        ImGui::SameLine();
+        ImGui::Checkbox("Evil host", &is_evil);
+        if (show_hints) {
+            ImGui::TextUnformatted(hint_text.c_str());
+            if (game.state() == wordle::GameState::PLAYING) {
+                ImGui::TextUnformatted(best_guess_text.c_str());
+            }
+        }
+        ImGui::SetWindowFontScale(4.f);
+
+        if (is_not_a_word) {
+            constexpr const char* not_a_word_text = "Not in word list";
+            const auto text_width = ImGui::CalcTextSize(not_a_word_text).x;
+            ImGui::SetCursorPosX((ImGui::GetWindowSize().x - text_width) * 0.5f);
+            ImGui::TextUnformatted(not_a_word_text);
+        }
+
+        constexpr const char* win_text = "YOU WIN!";
+        constexpr const char* lost_text = "YOU LOST...";
 
-        switch (current_game_state) {
-            case GameState::LOST: {
+        switch (game.state()) {
+            case wordle::GameState::LOST: {
                 auto windowWidth = ImGui::GetWindowSize().x;
-                auto textWidth = ImGui::CalcTextSize(lost_text.c_str()).x;
+                auto textWidth = ImGui::CalcTextSize(lost_text).x;
 
                 ImGui::SetCursorPosX((windowWidth - textWidth) * 0.5f);
-                ImGui::Text(lost_text.c_str());
-                const auto word = fmt::format("The word was: {}", word_to_guess);
-                auto wordTextWidth = ImGui::CalcTextSize(word.c_str()).x;
+                ImGui::TextUnformatted(lost_text);
+                auto wordTextWidth = ImGui::CalcTextSize(word_reveal_text.c_str()).x;
                 ImGui::SetCursorPosX((windowWidth - wordTextWidth) * 0.5f);
-                ImGui::Text(word.c_str());
+                ImGui::TextUnformatted(word_reveal_text.c_str());
             } break;
-            case GameState::WON: {
+            case wordle::GameState::WON: {
                 auto windowWidth = ImGui::GetWindowSize().x;
-                auto textWidth = ImGui::CalcTextSize(win_text.c_str()).x;
+                auto textWidth = ImGui::CalcTextSize(win_text).x;
                 ImGui::SetCursorPosX((windowWidth - textWidth) * 0.5f);
-                ImGui::Text(win_text.c_str());
+                ImGui::TextUnformatted(win_text);
 
             } break;
             default:
@@ -328,12 +486,127 @@ int main() {
 
         ImGui::End();
 
-        ImGui::Render();
-        glViewport(0, 0, static_cast<int>(io.DisplaySize.x), static_cast<int>(io.DisplaySize.y));
-        glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
-        glClear(GL_COLOR_BUFFER_BIT);
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-        SDL_GL_SwapWindow(window);
+#ifdef WORDLE_TRACING
+        trace_overlay.draw();
+#endif
+
+        {
+            WORDLE_TRACE_SCOPE("render");
+            ImGui::Render();
+            glViewport(0, 0, static_cast<int>(io.DisplaySize.x), static_cast<int>(io.DisplaySize.y));
+            glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
+            glClear(GL_COLOR_BUFFER_BIT);
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        }
+        {
+            WORDLE_TRACE_SCOPE("swap_window");
+            SDL_GL_SwapWindow(window);
+        }
+
+        scheduler.frame_drawn();
+        const auto frame_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame_start).count();
+        frame_stats.record(frame_ms);
+
+        // Frames without any event must not allocate, anything that does belongs in an event handler
+        if (is_steady_frame) {
+            steady_frames++;
+            frame_stats.record_allocations(wordle::allocation_count() - frame_allocations);
+        }
+
+        WORDLE_TRACE_COUNTERS();
+#ifdef WORDLE_TRACING
+        trace_overlay.frame_done(frame_ms, wordle::allocation_count() - frame_allocations, wordle::allocation_count());
+#endif
+    }
+
+    fmt::print("{} frames, p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms, {} over the {:.1f} ms budget\n", frame_stats.frame_count(), frame_stats.percentile(0.5),
+               frame_stats.percentile(0.99), frame_stats.percentile(1.0), frame_stats.missed_frames(), frame_stats.budget_ms());
+    fmt::print("{} idle frames, {} of them allocated\n", steady_frames, frame_stats.allocating_frames());
+
+    return EXIT_SUCCESS;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--length" && has_value) {
+            options.word_length = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--answers" && has_value) {
+            options.answers_path = argv[++i];
+        } else if (arg == "--allowed" && has_value) {
+            options.allowed_path = argv[++i];
+        } else {
+            fmt::print("Usage: {} [--length {}-{}] [--answers FILE [--allowed FILE]]\n", argv[0], wordle::min_word_length, wordle::max_word_length);
+            return EXIT_FAILURE;
+        }
+    }
+    if (options.word_length < wordle::min_word_length || options.word_length > wordle::max_word_length) {
+        fmt::print("[ERROR] Words must have between {} and {} letters\n", wordle::min_word_length, wordle::max_word_length);
+        return EXIT_FAILURE;
+    }
+    if (options.answers_path.empty() && not options.allowed_path.empty()) {
+        fmt::print("[ERROR] --allowed needs --answers\n");
+        return EXIT_FAILURE;
+    }
+
+    // SDL and ImGui allocations count towards the allocations of a frame too. Has to happen before either allocates.
+    SDL_SetMemoryFunctions(wordle::counted_malloc, wordle::counted_calloc, wordle::counted_realloc, wordle::counted_free);
+    ImGui::SetAllocatorFunctions([](std::size_t size, void*) { return wordle::counted_malloc(size); },
+                                 [](void* pointer, void*) { wordle::counted_free(pointer); });
+
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fmt::print("[ERROR] Couldn't load SDL : {}\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, 0);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 6);
+
+    SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+    SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 23);
+    SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+
+    const auto window_flags = static_cast<SDL_WindowFlags>(SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
+    SDL_Window* window = SDL_CreateWindow("Wordle", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 800, 600, window_flags);
+
+    SDL_GLContext gl_context = SDL_GL_CreateContext(window);
+    SDL_GL_MakeCurrent(window, gl_context);
+    SDL_GL_SetSwapInterval(1); // Enable VSYNC
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+
+    io.Fonts->AddFontFromFileTTF("assets/liberation_font/LiberationSans-Bold.ttf", 16);
+
+    ImGui::StyleColorsDark();
+
+    ImGui_ImplSDL2_InitForOpenGL(window, gl_context);
+    const char* glsl_version = "#version 450";
+    ImGui_ImplOpenGL3_Init(glsl_version);
+
+    int result = EXIT_FAILURE;
+    switch (options.word_length) {
+        case 4:
+            result = play<4>(window, io, options);
+            break;
+        case 5:
+            result = play<5>(window, io, options);
+            break;
+        case 6:
+            result = play<6>(window, io, options);
+            break;
+        case 7:
+            result = play<7>(window, io, options);
+            break;
+        case 8:
+            result = play<8>(window, io, options);
+            break;
     }
 
     // Cleanup
@@ -347,5 +620,5 @@ int main() {
 
     SDL_Quit();
 
-    return EXIT_SUCCESS;
+    return result;
 }
@@ -0,0 +1,128 @@
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "mapped_file.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WORDLE_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace wordle {
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        is_mapped_ = std::exchange(other.is_mapped_, false);
+        fallback_ = std::move(other.fallback_);
+    }
+    return *this;
+}
+
+void MappedFile::release() {
+#ifdef WORDLE_HAS_MMAP
+    if (is_mapped_ && size_ > 0) {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    is_mapped_ = false;
+    fallback_.clear();
+}
+
+std::optional<MappedFile> MappedFile::open(std::filesystem::path const& path) {
+    MappedFile result;
+
+#ifdef WORDLE_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return {};
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return {};
+    }
+
+    result.size_ = static_cast<std::size_t>(info.st_size);
+    if (result.size_ > 0) {
+        void* mapped = ::mmap(nullptr, result.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            ::close(fd);
+            return {};
+        }
+        result.data_ = static_cast<const std::byte*>(mapped);
+        result.is_mapped_ = true;
+    }
+    ::close(fd);
+#else
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path, error);
+    if (error) {
+        return {};
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    result.fallback_.resize(size);
+    if (not file.read(reinterpret_cast<char*>(result.fallback_.data()), static_cast<long>(size))) {
+        return {};
+    }
+    result.data_ = result.fallback_.data();
+    result.size_ = size;
+#endif
+
+    return result;
+}
+
+std::optional<CacheFile> open_cache(std::filesystem::path const& path, CacheHeader const& expected) {
+    auto file = MappedFile::open(path);
+    if (not file || file->size() < sizeof(CacheHeader)) {
+        return {};
+    }
+
+    CacheHeader header{};
+    std::memcpy(&header, file->bytes().data(), sizeof(header));
+    if (header.magic != expected.magic || header.version != expected.version || header.word_length != expected.word_length || header.key != expected.key) {
+        return {};
+    }
+    return CacheFile{std::move(*file), header};
+}
+
+bool write_cache(std::filesystem::path const& path, CacheHeader const& header, std::span<const std::byte> records) {
+    auto temporary = path;
+    temporary += ".tmp";
+
+    // Closed before checking, flushing the last of it can fail too (a full disk)
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(records.data()), static_cast<long>(records.size()));
+    file.close();
+
+    std::error_code error;
+    if (file) {
+        std::filesystem::rename(temporary, path, error);
+    }
+    if (not file || error) {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
+
+}; // namespace wordle
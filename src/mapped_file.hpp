@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace wordle {
+
+// Read-only view of a whole file. Memory mapped where the platform allows it, read in one go otherwise.
+class MappedFile {
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    static std::optional<MappedFile> open(std::filesystem::path const& path);
+
+    [[nodiscard]] std::span<const std::byte> bytes() const { return {data_, size_}; }
+    [[nodiscard]] std::size_t size() const { return size_; }
+
+  private:
+    void release();
+
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool is_mapped_ = false;
+    std::vector<std::byte> fallback_;
+};
+
+// Start of every cache file: what it holds, which word lists it was built from and two counts whose meaning is up to
+// the cache. Fixed size records follow.
+struct CacheHeader {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t word_length;
+    std::uint64_t key;
+    std::array<std::uint32_t, 2> counts;
+};
+static_assert(sizeof(CacheHeader) == 32);
+
+struct CacheFile {
+    MappedFile file;
+    CacheHeader header;
+
+    [[nodiscard]] std::span<const std::byte> records() const { return file.bytes().subspan(sizeof(CacheHeader)); }
+};
+
+// Maps the cache file if its magic, version, word length and key are the expected ones, its counts are left to the
+// caller to check. Nothing otherwise.
+std::optional<CacheFile> open_cache(std::filesystem::path const& path, CacheHeader const& expected);
+
+// Writes the header and the records next to the destination then renames the file over it, so a reader never maps a
+// half written file.
+bool write_cache(std::filesystem::path const& path, CacheHeader const& header, std::span<const std::byte> records);
+
+}; // namespace wordle
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "scoring.hpp"
+
+namespace wordle {
+
+// Messages between wordle_server and its clients. Every message has a fixed size and is sent as is, in host byte
+// order: the server only listens on a Unix domain socket so both ends always share it.
+enum class MessageType : std::uint8_t { NEW_GAME = 1, SUBMIT = 2, CLOSE = 3 };
+
+enum class ResponseStatus : std::uint8_t { OK, UNKNOWN_SESSION, NOT_A_WORD, GAME_OVER, SERVER_FULL, BAD_REQUEST };
+
+constexpr std::string_view status_name(ResponseStatus status) {
+    switch (status) {
+        case ResponseStatus::OK:
+            return "OK";
+        case ResponseStatus::UNKNOWN_SESSION:
+            return "UNKNOWN_SESSION";
+        case ResponseStatus::NOT_A_WORD:
+            return "NOT_A_WORD";
+        case ResponseStatus::GAME_OVER:
+            return "GAME_OVER";
+        case ResponseStatus::SERVER_FULL:
+            return "SERVER_FULL";
+        case ResponseStatus::BAD_REQUEST:
+            return "BAD_REQUEST";
+    }
+    return "UNKNOWN";
+}
+
+struct Request {
+    MessageType type;
+    std::array<std::uint8_t, 7> reserved;
+    std::uint64_t session; // ignored by NEW_GAME
+    PackedWord guess;      // SUBMIT only
+};
+static_assert(sizeof(Request) == 24);
+
+struct Response {
+    ResponseStatus status;
+    std::uint8_t state; // GameState
+    std::uint8_t tries;
+    Feedback feedback; // of the submitted guess
+    std::array<std::uint8_t, 4> reserved;
+    std::uint64_t session;
+    PackedWord answer; // only once the game is over
+};
+static_assert(sizeof(Response) == 24);
+
+}; // namespace wordle
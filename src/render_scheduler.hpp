@@ -0,0 +1,29 @@
+#pragma once
+
+#include <algorithm>
+
+namespace wordle {
+
+// Decides when the UI loop may block waiting for events instead of redrawing at vsync rate.
+// Input and anything animating ask for a few frames, once they are drawn the loop goes idle.
+class RenderScheduler {
+  public:
+    // ImGui needs a couple of frames after an event for hover, focus and layout to settle
+    static constexpr int frames_after_input = 3;
+
+    explicit RenderScheduler(int idle_timeout_ms = 500) : idle_timeout_ms_(idle_timeout_ms) {}
+
+    void request_frames(int frames = frames_after_input) { pending_frames_ = std::max(pending_frames_, frames); }
+    void frame_drawn() { pending_frames_ = std::max(0, pending_frames_ - 1); }
+
+    [[nodiscard]] bool is_idle() const { return pending_frames_ == 0; }
+
+    // Idle frames still happen this often, the text cursor keeps blinking
+    [[nodiscard]] int idle_timeout_ms() const { return idle_timeout_ms_; }
+
+  private:
+    int idle_timeout_ms_;
+    int pending_frames_ = frames_after_input;
+};
+
+}; // namespace wordle
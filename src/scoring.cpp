@@ -0,0 +1,225 @@
+#include <cassert>
+#include <cctype>
+#include <utility>
+
+#include "scoring.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+namespace {
+// SWAR helpers, every byte of a PackedWord is a lane and only the first N lanes hold letters
+constexpr std::uint64_t low_bits = 0x7F7F7F7F7F7F7F7FULL;
+
+template <std::size_t N>
+constexpr std::uint64_t lane_ones = 0x0101010101010101ULL >> (8 * (max_word_length - N));
+
+template <std::size_t N>
+constexpr std::uint64_t lane_high_bits = lane_ones<N> << 7;
+
+template <std::size_t N>
+constexpr auto trit_weights = [] {
+    std::array<std::uint32_t, N> weights{};
+    std::uint32_t weight = 1;
+    for (auto& w : weights) {
+        w = weight;
+        weight *= 3;
+    }
+    return weights;
+}();
+
+// Calls body(std::integral_constant<std::size_t, I>) for I in [0, N), unrolled at compile time
+template <std::size_t N, typename Body>
+constexpr void unroll(Body&& body) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) { (body(std::integral_constant<std::size_t, I>{}), ...); }(std::make_index_sequence<N>{});
+}
+
+// 0x80 in every lane of x that is zero, nothing anywhere else
+template <std::size_t N>
+constexpr std::uint64_t zero_lanes(std::uint64_t x) {
+    return ~(((x & low_bits) + low_bits) | x | low_bits) & lane_high_bits<N>;
+}
+
+// Number of lanes flagged by zero_lanes, the multiply sums every lane into lane N - 1
+template <std::size_t N>
+constexpr std::uint32_t count_lanes(std::uint64_t mask) {
+    return static_cast<std::uint32_t>((((mask >> 7) * lane_ones<N>) >> (8 * (N - 1))) & 0xFF);
+}
+
+template <std::size_t N>
+constexpr std::uint64_t broadcast(std::uint64_t letter) {
+    return letter * lane_ones<N>;
+}
+
+constexpr std::uint64_t letter_at(PackedWord word, std::size_t i) {
+    return (word >> (8 * i)) & 0xFF;
+}
+} // namespace
+
+std::vector<LetterValidity> check_validity(std::string const& original, std::string const& submitted) {
+    using enum LetterValidity;
+
+    std::vector<LetterValidity> result(original.size());
+
+    for (std::size_t i = 0; i < original.size(); i++) {
+        if (std::toupper(original[i]) == submitted[i]) {
+            result[i] = VALID;
+        } else {
+            int subCounter = 0;
+            int subOriginal = 0;
+
+            for (std::size_t j = 0; j < original.size(); j++) {
+                if (std::toupper(original[j]) == submitted[i]) {
+                    subOriginal++;
+                }
+                if (submitted[j] == submitted[i]) {
+                    subCounter++;
+                }
+            }
+
+            if (subOriginal > 0 && subCounter <= subOriginal) {
+                result[i] = VALID_WRONG_PLACE;
+            } else {
+                result[i] = INVALID;
+            }
+        }
+    }
+
+    return result;
+}
+
+PackedWord pack_word(std::string_view word) {
+    assert(word.size() <= max_word_length);
+
+    PackedWord packed = 0;
+    for (std::size_t i = 0; i < word.size(); i++) {
+        const auto c = static_cast<std::uint64_t>(std::toupper(static_cast<unsigned char>(word[i])));
+        packed |= c << (8 * i);
+    }
+    return packed;
+}
+
+std::string unpack_word(PackedWord word) {
+    std::string result;
+    for (std::size_t i = 0; i < max_word_length && letter_at(word, i) != 0; i++) {
+        result.push_back(static_cast<char>(letter_at(word, i)));
+    }
+    return result;
+}
+
+template <std::size_t N>
+FeedbackOf<N> encode_feedback(std::span<const LetterValidity> validity) {
+    assert(validity.size() <= N);
+
+    std::uint32_t result = 0;
+    for (std::size_t i = 0; i < validity.size(); i++) {
+        switch (validity[i]) {
+            case LetterValidity::VALID:
+                result += 2 * trit_weights<N>[i];
+                break;
+            case LetterValidity::VALID_WRONG_PLACE:
+                result += trit_weights<N>[i];
+                break;
+            default:
+                break;
+        }
+    }
+    return static_cast<FeedbackOf<N>>(result);
+}
+
+template <std::size_t N>
+std::array<LetterValidity, N> decode_feedback(FeedbackOf<N> feedback) {
+    using enum LetterValidity;
+
+    std::array<LetterValidity, N> result{};
+    for (auto& v : result) {
+        switch (feedback % 3) {
+            case 2:
+                v = VALID;
+                break;
+            case 1:
+                v = VALID_WRONG_PLACE;
+                break;
+            default:
+                v = INVALID;
+                break;
+        }
+        feedback = static_cast<FeedbackOf<N>>(feedback / 3);
+    }
+    return result;
+}
+
+// A misplaced letter is only VALID_WRONG_PLACE when the answer holds at least as many copies of it as the guess,
+// greens included. That is exactly what check_validity does, so it is enough to compare per letter counts.
+template <std::size_t N>
+FeedbackOf<N> score(PackedWord answer, PackedWord guess) {
+    WORDLE_TRACE_COUNT(SCORE_CALLS, 1);
+
+    const auto green = zero_lanes<N>(answer ^ guess);
+
+    std::uint32_t result = 0;
+    unroll<N>([&](auto i) {
+        const auto letter = broadcast<N>(letter_at(guess, i));
+        const auto in_answer = count_lanes<N>(zero_lanes<N>(answer ^ letter));
+        const auto in_guess = count_lanes<N>(zero_lanes<N>(guess ^ letter));
+        const auto is_green = (green >> (8 * i + 7)) & 1;
+        const auto trit = is_green != 0 ? 2U : (in_answer >= in_guess ? 1U : 0U);
+        result += trit * trit_weights<N>[i];
+    });
+    return static_cast<FeedbackOf<N>>(result);
+}
+
+template <std::size_t N>
+void score_batch(PackedWord guess, std::span<const PackedWord> answers, std::span<FeedbackOf<N>> out) {
+    assert(out.size() >= answers.size());
+    WORDLE_TRACE_COUNT(SCORE_CALLS, answers.size());
+
+    // Everything that only depends on the guess is hoisted out of the answer loop
+    std::array<std::uint64_t, N> letters{};
+    std::array<std::uint32_t, N> in_guess{};
+    for (std::size_t i = 0; i < N; i++) {
+        letters[i] = broadcast<N>(letter_at(guess, i));
+        in_guess[i] = count_lanes<N>(zero_lanes<N>(guess ^ letters[i]));
+    }
+
+    for (std::size_t a = 0; a < answers.size(); a++) {
+        const auto answer = answers[a];
+        const auto green = zero_lanes<N>(answer ^ guess);
+
+        std::uint32_t result = 0;
+        unroll<N>([&](auto i) {
+            const auto in_answer = count_lanes<N>(zero_lanes<N>(answer ^ letters[i]));
+            const auto is_green = static_cast<std::uint32_t>((green >> (8 * i + 7)) & 1);
+            const auto is_misplaced = static_cast<std::uint32_t>(in_answer >= in_guess[i]);
+            result += (is_green + (is_green | is_misplaced)) * trit_weights<N>[i];
+        });
+        out[a] = static_cast<FeedbackOf<N>>(result);
+    }
+}
+
+// One specialization per supported length, picked by the caller once it knows which word pack it plays
+template FeedbackOf<4> encode_feedback<4>(std::span<const LetterValidity>);
+template FeedbackOf<5> encode_feedback<5>(std::span<const LetterValidity>);
+template FeedbackOf<6> encode_feedback<6>(std::span<const LetterValidity>);
+template FeedbackOf<7> encode_feedback<7>(std::span<const LetterValidity>);
+template FeedbackOf<8> encode_feedback<8>(std::span<const LetterValidity>);
+
+template std::array<LetterValidity, 4> decode_feedback<4>(FeedbackOf<4>);
+template std::array<LetterValidity, 5> decode_feedback<5>(FeedbackOf<5>);
+template std::array<LetterValidity, 6> decode_feedback<6>(FeedbackOf<6>);
+template std::array<LetterValidity, 7> decode_feedback<7>(FeedbackOf<7>);
+template std::array<LetterValidity, 8> decode_feedback<8>(FeedbackOf<8>);
+
+template FeedbackOf<4> score<4>(PackedWord, PackedWord);
+template FeedbackOf<5> score<5>(PackedWord, PackedWord);
+template FeedbackOf<6> score<6>(PackedWord, PackedWord);
+template FeedbackOf<7> score<7>(PackedWord, PackedWord);
+template FeedbackOf<8> score<8>(PackedWord, PackedWord);
+
+template void score_batch<4>(PackedWord, std::span<const PackedWord>, std::span<FeedbackOf<4>>);
+template void score_batch<5>(PackedWord, std::span<const PackedWord>, std::span<FeedbackOf<5>>);
+template void score_batch<6>(PackedWord, std::span<const PackedWord>, std::span<FeedbackOf<6>>);
+template void score_batch<7>(PackedWord, std::span<const PackedWord>, std::span<FeedbackOf<7>>);
+template void score_batch<8>(PackedWord, std::span<const PackedWord>, std::span<FeedbackOf<8>>);
+
+}; // namespace wordle
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace wordle {
+enum class LetterValidity { VALID, VALID_WRONG_PLACE, INVALID };
+
+// Reference implementation, works on any word length. Prefer the packed API below for anything hot.
+std::vector<LetterValidity> check_validity(std::string const& original, std::string const& submitted);
+
+// One uppercase ASCII letter per byte, first letter in the lowest byte, unused bytes are zero.
+using PackedWord = std::uint64_t;
+
+inline constexpr std::size_t min_word_length = 4;
+inline constexpr std::size_t max_word_length = sizeof(PackedWord);
+
+// Feedback for a whole word as a base-3 number, first letter in the lowest trit.
+// INVALID = 0, VALID_WRONG_PLACE = 1, VALID = 2. Up to 5 letters it fits in a byte.
+template <std::size_t N>
+struct WordTraits {
+    static_assert(N >= min_word_length && N <= max_word_length, "Unsupported word length");
+
+    using Feedback = std::conditional_t<(N <= 5), std::uint8_t, std::uint16_t>;
+
+    static constexpr std::size_t feedback_patterns = [] {
+        std::size_t patterns = 1;
+        for (std::size_t i = 0; i < N; i++) {
+            patterns *= 3;
+        }
+        return patterns;
+    }();
+    static constexpr auto all_valid_feedback = static_cast<Feedback>(feedback_patterns - 1);
+};
+
+template <std::size_t N>
+using FeedbackOf = typename WordTraits<N>::Feedback;
+
+// The classic game. Everything that takes a length defaults to it.
+inline constexpr std::size_t word_length = 5;
+using Feedback = FeedbackOf<word_length>;
+inline constexpr std::size_t feedback_patterns = WordTraits<word_length>::feedback_patterns;
+inline constexpr Feedback all_valid_feedback = WordTraits<word_length>::all_valid_feedback;
+
+// Any length up to max_word_length
+PackedWord pack_word(std::string_view word);
+std::string unpack_word(PackedWord word);
+
+template <std::size_t N = word_length>
+FeedbackOf<N> encode_feedback(std::span<const LetterValidity> validity);
+
+template <std::size_t N = word_length>
+std::array<LetterValidity, N> decode_feedback(FeedbackOf<N> feedback);
+
+// Same result as check_validity(answer, guess), without any allocation.
+template <std::size_t N = word_length>
+FeedbackOf<N> score(PackedWord answer, PackedWord guess);
+
+// Scores one guess against every answer, out must be at least as big as answers.
+template <std::size_t N = word_length>
+void score_batch(PackedWord guess, std::span<const PackedWord> answers, std::span<FeedbackOf<N>> out);
+
+}; // namespace wordle
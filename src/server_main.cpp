@@ -0,0 +1,334 @@
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "protocol.hpp"
+#include "session_pool.hpp"
+#include "word_list.hpp"
+
+namespace {
+struct Options {
+    std::string socket_path = "/tmp/wordle.sock";
+    std::size_t sessions = 65536;
+    std::filesystem::path answers_path; // the bundled lists when empty
+    std::filesystem::path allowed_path;
+};
+
+volatile std::sig_atomic_t is_running = 1;
+
+// Past this many bytes of responses waiting to be sent, a connection isn't read from until its peer catches up
+constexpr std::size_t max_pending_output = 1024 * sizeof(wordle::Response);
+
+// Reads of a single connection per wakeup, so that one busy peer can't keep the others waiting. Whatever is left stays
+// in the socket and wakes the loop up again.
+constexpr std::size_t max_reads_per_wakeup = 4;
+
+struct Connection {
+    int fd = -1;
+    std::array<std::byte, 64 * sizeof(wordle::Request)> input{};
+    std::size_t input_size = 0;
+    std::vector<std::byte> output;
+    std::uint32_t events = EPOLLIN; // what it is registered for
+    std::vector<wordle::SessionPool::SessionId> sessions; // closed along with the connection
+};
+
+class Server {
+  public:
+    Server(wordle::WordLists const& word_lists, std::size_t sessions)
+        : word_lists_(word_lists), pool_(sessions), rand_(std::random_device()()), uniform_answer_(0, word_lists.answers.size() - 1),
+          weighted_answer_(word_lists.answer_weights.begin(), word_lists.answer_weights.end()) {}
+
+    int run(int listen_fd);
+
+  private:
+    void accept_all(int listen_fd);
+    bool read_from(Connection& connection);
+    bool flush(Connection& connection);
+    void disconnect(Connection& connection);
+    wordle::Response handle(Connection& connection, wordle::Request const& request);
+
+    wordle::WordLists const& word_lists_; // shared by every session, never written
+    wordle::SessionPool pool_;
+    std::minstd_rand rand_;
+    std::uniform_int_distribution<std::size_t> uniform_answer_;
+    std::discrete_distribution<std::size_t> weighted_answer_; // used instead when the answers have frequencies
+    int epoll_fd_ = -1;
+    std::vector<std::unique_ptr<Connection>> connections_; // indexed by fd
+};
+
+bool set_non_blocking(int fd) {
+    const auto flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+int listen_on(std::string const& path) {
+    sockaddr_un address{};
+    if (path.size() >= sizeof(address.sun_path)) {
+        return -1;
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    const auto fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    unlink(path.c_str());
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0 || not set_non_blocking(fd)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int Server::run(int listen_fd) {
+    epoll_fd_ = epoll_create1(0);
+    if (epoll_fd_ < 0) {
+        return EXIT_FAILURE;
+    }
+
+    epoll_event listen_event{};
+    listen_event.events = EPOLLIN;
+    listen_event.data.fd = listen_fd;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd, &listen_event);
+
+    std::array<epoll_event, 256> events{};
+    while (is_running) {
+        const auto count = epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), 500);
+        if (count < 0 && errno != EINTR) {
+            fmt::print("[ERROR] epoll_wait failed: {}\n", std::strerror(errno));
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            const auto fd = events[static_cast<std::size_t>(i)].data.fd;
+            if (fd == listen_fd) {
+                accept_all(listen_fd);
+                continue;
+            }
+
+            // Already gone if an earlier event of this batch disconnected it
+            if (not connections_[static_cast<std::size_t>(fd)]) {
+                continue;
+            }
+
+            auto& connection = *connections_[static_cast<std::size_t>(fd)];
+            const auto flags = events[static_cast<std::size_t>(i)].events;
+            const bool is_alive = (flags & (EPOLLERR | EPOLLHUP)) == 0 && ((flags & EPOLLIN) == 0 || read_from(connection)) && flush(connection);
+            if (not is_alive) {
+                disconnect(connection);
+            }
+        }
+    }
+
+    for (auto& connection : connections_) {
+        if (connection) {
+            disconnect(*connection);
+        }
+    }
+    close(epoll_fd_);
+    return EXIT_SUCCESS;
+}
+
+void Server::accept_all(int listen_fd) {
+    for (;;) {
+        const auto fd = accept4(listen_fd, nullptr, nullptr, SOCK_NONBLOCK);
+        if (fd < 0) {
+            return;
+        }
+
+        const auto index = static_cast<std::size_t>(fd);
+        if (index >= connections_.size()) {
+            connections_.resize(index + 1);
+        }
+        connections_[index] = std::make_unique<Connection>();
+        connections_[index]->fd = fd;
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event);
+    }
+}
+
+// Reads what is available and answers every complete request, up to max_reads_per_wakeup reads and as long as the
+// output isn't full. False once the peer is gone.
+bool Server::read_from(Connection& connection) {
+    for (std::size_t reads = 0; reads < max_reads_per_wakeup && connection.output.size() < max_pending_output; reads++) {
+        const auto received = read(connection.fd, connection.input.data() + connection.input_size, connection.input.size() - connection.input_size);
+        if (received == 0) {
+            return false;
+        }
+        if (received < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+        connection.input_size += static_cast<std::size_t>(received);
+
+        std::size_t consumed = 0;
+        for (; consumed + sizeof(wordle::Request) <= connection.input_size; consumed += sizeof(wordle::Request)) {
+            wordle::Request request{};
+            std::memcpy(&request, connection.input.data() + consumed, sizeof(request));
+
+            const auto response = handle(connection, request);
+            const auto* bytes = reinterpret_cast<const std::byte*>(&response);
+            connection.output.insert(connection.output.end(), bytes, bytes + sizeof(response));
+        }
+        std::memmove(connection.input.data(), connection.input.data() + consumed, connection.input_size - consumed);
+        connection.input_size -= consumed;
+    }
+    return true;
+}
+
+// Writes as much as the socket takes. Only asks for EPOLLOUT while something is left, and for EPOLLIN while the output
+// is below max_pending_output.
+bool Server::flush(Connection& connection) {
+    std::size_t written = 0;
+    while (written < connection.output.size()) {
+        const auto sent = send(connection.fd, connection.output.data() + written, connection.output.size() - written, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<std::size_t>(sent);
+    }
+    connection.output.erase(connection.output.begin(), connection.output.begin() + static_cast<long>(written));
+
+    const std::uint32_t events = (connection.output.size() < max_pending_output ? EPOLLIN : 0U) | (connection.output.empty() ? 0U : EPOLLOUT);
+    if (events != connection.events) {
+        connection.events = events;
+
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = connection.fd;
+        epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, connection.fd, &event);
+    }
+    return true;
+}
+
+void Server::disconnect(Connection& connection) {
+    for (const auto session : connection.sessions) {
+        pool_.close(session);
+    }
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connection.fd, nullptr);
+    close(connection.fd);
+    connections_[static_cast<std::size_t>(connection.fd)].reset();
+}
+
+wordle::Response Server::handle(Connection& connection, wordle::Request const& request) {
+    wordle::Response response{};
+    response.session = request.session;
+
+    switch (request.type) {
+        case wordle::MessageType::NEW_GAME: {
+            const auto answer = word_lists_.answer_weights.empty() ? uniform_answer_(rand_) : weighted_answer_(rand_);
+            const auto session = pool_.open(word_lists_.answers[answer]);
+            if (not session) {
+                response.status = wordle::ResponseStatus::SERVER_FULL;
+                break;
+            }
+            connection.sessions.push_back(*session);
+            response.session = *session;
+        } break;
+        case wordle::MessageType::SUBMIT: {
+            auto* game = pool_.find(request.session);
+            if (game == nullptr) {
+                response.status = wordle::ResponseStatus::UNKNOWN_SESSION;
+                break;
+            }
+            if (game->state() != wordle::GameState::PLAYING) {
+                response.status = wordle::ResponseStatus::GAME_OVER;
+            } else if (not word_lists_.guesses.contains(request.guess)) {
+                response.status = wordle::ResponseStatus::NOT_A_WORD;
+            } else {
+                response.feedback = game->submit(request.guess);
+            }
+            response.state = static_cast<std::uint8_t>(game->state());
+            response.tries = static_cast<std::uint8_t>(game->tries());
+            if (game->state() != wordle::GameState::PLAYING) {
+                response.answer = game->answer();
+            }
+        } break;
+        case wordle::MessageType::CLOSE:
+            if (not pool_.close(request.session)) {
+                response.status = wordle::ResponseStatus::UNKNOWN_SESSION;
+                break;
+            }
+            std::erase(connection.sessions, request.session);
+            break;
+        default:
+            response.status = wordle::ResponseStatus::BAD_REQUEST;
+            break;
+    }
+
+    return response;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--socket" && has_value) {
+            options.socket_path = argv[++i];
+        } else if (arg == "--sessions" && has_value) {
+            options.sessions = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--answers" && has_value) {
+            options.answers_path = argv[++i];
+        } else if (arg == "--allowed" && has_value) {
+            options.allowed_path = argv[++i];
+        } else {
+            fmt::print("Usage: {} [--socket PATH] [--sessions N] [--answers FILE [--allowed FILE]]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const bool is_custom = not options.answers_path.empty();
+    const auto word_lists = is_custom ? wordle::load_word_list_files(options.answers_path, options.allowed_path) : wordle::load_word_lists("assets");
+    if (not word_lists.unreadable_file.empty()) {
+        fmt::print("[ERROR] Couldn't read the word list {}\n", word_lists.unreadable_file.string());
+        return EXIT_FAILURE;
+    }
+    if (word_lists.answers.empty()) {
+        fmt::print("[ERROR] No answers in {}\n", is_custom ? options.answers_path.string() : std::string("assets/"));
+        return EXIT_FAILURE;
+    }
+
+    const auto listen_fd = listen_on(options.socket_path);
+    if (listen_fd < 0) {
+        fmt::print("[ERROR] Couldn't listen on {}: {}\n", options.socket_path, std::strerror(errno));
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, [](int) { is_running = 0; });
+    std::signal(SIGTERM, [](int) { is_running = 0; });
+
+    fmt::print("Serving up to {} games on {}\n", options.sessions, options.socket_path);
+    const auto result = Server(word_lists, options.sessions).run(listen_fd);
+
+    close(listen_fd);
+    unlink(options.socket_path.c_str());
+    return result;
+}
@@ -0,0 +1,52 @@
+#include "session_pool.hpp"
+
+namespace wordle {
+
+SessionPool::SessionPool(std::size_t capacity) : slots_(capacity) {
+    free_.reserve(capacity);
+    for (std::size_t i = capacity; i-- > 0;) {
+        free_.push_back(static_cast<std::uint32_t>(i));
+    }
+}
+
+std::optional<SessionPool::SessionId> SessionPool::open(PackedWord answer, std::size_t max_tries) {
+    if (free_.empty()) {
+        return {};
+    }
+
+    const auto index = free_.back();
+    free_.pop_back();
+
+    auto& slot = slots_[index];
+    slot.game = Game(answer, max_tries);
+    slot.is_open = true;
+    return (SessionId{slot.generation} << 32) | index;
+}
+
+Game* SessionPool::find(SessionId id) {
+    const auto index = static_cast<std::size_t>(id & 0xFFFFFFFF);
+    if (index >= slots_.size()) {
+        return nullptr;
+    }
+
+    auto& slot = slots_[index];
+    if (not slot.is_open || slot.generation != static_cast<std::uint32_t>(id >> 32)) {
+        return nullptr;
+    }
+    return &slot.game;
+}
+
+bool SessionPool::close(SessionId id) {
+    if (find(id) == nullptr) {
+        return false;
+    }
+
+    const auto index = static_cast<std::uint32_t>(id & 0xFFFFFFFF);
+    auto& slot = slots_[index];
+    slot.is_open = false;
+    slot.generation++;
+    free_.push_back(index);
+    return true;
+}
+
+}; // namespace wordle
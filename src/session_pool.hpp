@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "game.hpp"
+#include "scoring.hpp"
+
+namespace wordle {
+
+// Every game a server can host at once, allocated up front. A session id is the slot index in the low 32 bits and the
+// slot generation in the high ones, so the id of a closed session never reaches the game that reuses its slot.
+class SessionPool {
+  public:
+    using SessionId = std::uint64_t;
+
+    explicit SessionPool(std::size_t capacity);
+
+    // Nothing when every slot is taken
+    std::optional<SessionId> open(PackedWord answer, std::size_t max_tries = Game::max_rows);
+
+    // Null for unknown or closed sessions
+    [[nodiscard]] Game* find(SessionId id);
+
+    bool close(SessionId id);
+
+    [[nodiscard]] std::size_t size() const { return slots_.size() - free_.size(); }
+    [[nodiscard]] std::size_t capacity() const { return slots_.size(); }
+
+  private:
+    struct Slot {
+        Game game{0};
+        std::uint32_t generation = 0;
+        bool is_open = false;
+    };
+
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> free_; // used as a stack, recently closed slots are still in cache
+};
+
+}; // namespace wordle
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+
+#include "solver.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+template <std::size_t N>
+BasicSolver<N>::BasicSolver(BasicFeedbackMatrix<N> const& matrix, ThreadPool* pool, std::span<const float> answer_weights)
+    : matrix_(matrix), pool_(pool), answer_weights_(answer_weights) {
+    weighted_log_.resize(matrix_.answer_count() + 1);
+    for (std::size_t c = 1; c < weighted_log_.size(); c++) {
+        weighted_log_[c] = static_cast<double>(c) * std::log2(static_cast<double>(c));
+    }
+    reset();
+}
+
+template <std::size_t N>
+void BasicSolver<N>::reset() {
+    remaining_.resize(matrix_.answer_count());
+    for (std::size_t i = 0; i < remaining_.size(); i++) {
+        remaining_[i] = static_cast<std::uint32_t>(i);
+    }
+    is_remaining_.assign(matrix_.answer_count(), true);
+}
+
+template <std::size_t N>
+void BasicSolver<N>::apply(std::size_t guess, Feedback feedback) {
+    const auto row = matrix_.row(guess);
+    std::erase_if(remaining_, [&](std::uint32_t answer) {
+        if (row[answer] != feedback) {
+            is_remaining_[answer] = false;
+            return true;
+        }
+        return false;
+    });
+}
+
+template <std::size_t N>
+void BasicSolver<N>::assign(std::span<const std::uint32_t> answers) {
+    remaining_.assign(answers.begin(), answers.end());
+    is_remaining_.assign(matrix_.answer_count(), false);
+    for (const auto answer : remaining_) {
+        is_remaining_[answer] = true;
+    }
+}
+
+template <std::size_t N>
+Suggestion BasicSolver<N>::best_guess() const {
+    return *best_guess(std::stop_token());
+}
+
+template <std::size_t N>
+std::optional<Suggestion> BasicSolver<N>::best_guess(std::stop_token stop) const {
+    WORDLE_TRACE_SCOPE("best_guess");
+
+    const bool uses_weights = not answer_weights_.empty();
+    if (remaining_.size() <= 2) {
+        const bool second_is_likelier = remaining_.size() == 2 && uses_weights && answer_weights_[remaining_[1]] > answer_weights_[remaining_[0]];
+        return Suggestion{remaining_[second_is_likelier ? 1 : 0], remaining_.size() == 2 ? 1.0 : 0.0};
+    }
+
+    // Weights only matter relative to their total. Answers left that all weigh nothing are back to being equally likely.
+    double total = static_cast<double>(remaining_.size());
+    bool is_weighted = false;
+    if (uses_weights) {
+        double weight = 0.0;
+        for (const auto answer : remaining_) {
+            weight += answer_weights_[answer];
+        }
+        if (weight > 0.0) {
+            total = weight;
+            is_weighted = true;
+        }
+    }
+    const auto log_total = std::log2(total);
+    const bool everything_remains = remaining_.size() == matrix_.answer_count();
+
+    std::mutex best_mutex;
+    Suggestion best{};
+    bool best_is_candidate = false;
+
+    auto search = [&](std::size_t first, std::size_t last) {
+        if (stop.stop_requested()) {
+            return;
+        }
+        WORDLE_TRACE_COUNT(ENTROPY_EVALUATIONS, last - first);
+
+        Suggestion local_best{};
+        bool local_is_candidate = false;
+        std::array<std::uint32_t, WordTraits<N>::feedback_patterns> counts{};
+        std::array<double, WordTraits<N>::feedback_patterns> masses{};
+
+        for (std::size_t guess = first; guess < last; guess++) {
+            const auto row = matrix_.row(guess);
+
+            double sum = 0.0;
+            if (is_weighted) {
+                for (const auto answer : remaining_) {
+                    masses[row[answer]] += answer_weights_[answer];
+                }
+                for (const auto answer : remaining_) {
+                    const auto mass = masses[row[answer]];
+                    sum += mass > 0.0 ? mass * std::log2(mass) : 0.0;
+                    masses[row[answer]] = 0.0;
+                }
+            } else if (everything_remains) {
+                for (const auto feedback : row) {
+                    counts[feedback]++;
+                }
+                for (auto& c : counts) {
+                    sum += weighted_log_[c];
+                    c = 0;
+                }
+            } else {
+                // Only the patterns that were hit are read back, and cleared on the way for the next guess
+                for (const auto answer : remaining_) {
+                    counts[row[answer]]++;
+                }
+                for (const auto answer : remaining_) {
+                    sum += weighted_log_[counts[row[answer]]];
+                    counts[row[answer]] = 0;
+                }
+            }
+            const auto entropy = log_total - sum / total;
+            const bool is_candidate = guess < is_remaining_.size() && is_remaining_[guess];
+
+            if (entropy > local_best.entropy + 1e-9 || (is_candidate && not local_is_candidate && entropy > local_best.entropy - 1e-9)) {
+                local_best = {guess, entropy};
+                local_is_candidate = is_candidate;
+            }
+        }
+
+        std::lock_guard lock(best_mutex);
+        const bool better = local_best.entropy > best.entropy + 1e-9 ||
+                            (std::abs(local_best.entropy - best.entropy) <= 1e-9 &&
+                             (local_is_candidate > best_is_candidate || (local_is_candidate == best_is_candidate && local_best.guess < best.guess)));
+        if (better) {
+            best = local_best;
+            best_is_candidate = local_is_candidate;
+        }
+    };
+
+    // Chunks are small enough that a stop request is noticed quickly
+    constexpr std::size_t guesses_per_chunk = 256;
+    if (pool_ != nullptr) {
+        pool_->parallel_for(matrix_.guess_count(), guesses_per_chunk, search);
+    } else {
+        for (std::size_t first = 0; first < matrix_.guess_count(); first += guesses_per_chunk) {
+            search(first, std::min(first + guesses_per_chunk, matrix_.guess_count()));
+        }
+    }
+
+    if (stop.stop_requested()) {
+        return {};
+    }
+
+    return best;
+}
+
+template class BasicSolver<4>;
+template class BasicSolver<5>;
+template class BasicSolver<6>;
+template class BasicSolver<7>;
+template class BasicSolver<8>;
+
+}; // namespace wordle
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <vector>
+
+#include "feedback_matrix.hpp"
+#include "thread_pool.hpp"
+
+namespace wordle {
+
+struct Suggestion {
+    std::size_t guess = 0;
+    double entropy = 0.0; // expected information in bits
+};
+
+// Picks the guess that splits the remaining answers best. Guesses and answers are indices in the matrix.
+// Without a pool the search runs on the calling thread, which is what you want when games are already spread
+// over the cores. With answer weights, answers are as likely as their weight instead of all equally likely.
+template <std::size_t N>
+class BasicSolver {
+  public:
+    using Feedback = FeedbackOf<N>;
+
+    explicit BasicSolver(BasicFeedbackMatrix<N> const& matrix, ThreadPool* pool = nullptr, std::span<const float> answer_weights = {});
+
+    // Every answer becomes possible again
+    void reset();
+
+    // Keeps only the answers that would have produced this feedback for this guess
+    void apply(std::size_t guess, Feedback feedback);
+
+    // Keeps exactly these answers, in this order
+    void assign(std::span<const std::uint32_t> answers);
+
+    [[nodiscard]] std::span<const std::uint32_t> remaining() const { return remaining_; }
+
+    // Searches every guess, ties go to guesses that could still be the answer. Needs at least one remaining answer.
+    // With two answers left it is the more likely one.
+    [[nodiscard]] Suggestion best_guess() const;
+
+    // Same search, gives up and returns nothing as soon as a stop is requested
+    [[nodiscard]] std::optional<Suggestion> best_guess(std::stop_token stop) const;
+
+  private:
+    BasicFeedbackMatrix<N> const& matrix_;
+    ThreadPool* pool_;
+    std::span<const float> answer_weights_;
+    std::vector<std::uint32_t> remaining_;
+    std::vector<bool> is_remaining_;
+    std::vector<double> weighted_log_; // c * log2(c), indexed by c
+};
+
+using Solver = BasicSolver<word_length>;
+
+}; // namespace wordle
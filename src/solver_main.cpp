@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+
+#include <fmt/core.h>
+
+#include "feedback_matrix.hpp"
+#include "solver.hpp"
+#include "thread_pool.hpp"
+#include "word_list.hpp"
+
+namespace {
+// One character per letter: g for VALID, y for VALID_WRONG_PLACE, anything in ".-_bx" for INVALID
+std::optional<wordle::Feedback> parse_feedback(std::string_view pattern) {
+    using enum wordle::LetterValidity;
+
+    if (pattern.size() != wordle::word_length) {
+        return {};
+    }
+
+    std::array<wordle::LetterValidity, wordle::word_length> validity{};
+    for (std::size_t i = 0; i < pattern.size(); i++) {
+        switch (pattern[i]) {
+            case 'g':
+            case 'G':
+                validity[i] = VALID;
+                break;
+            case 'y':
+            case 'Y':
+                validity[i] = VALID_WRONG_PLACE;
+                break;
+            case '.':
+            case '-':
+            case '_':
+            case 'b':
+            case 'B':
+            case 'x':
+            case 'X':
+                validity[i] = INVALID;
+                break;
+            default:
+                return {};
+        }
+    }
+    return wordle::encode_feedback(validity);
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc % 2 == 0) {
+        fmt::print("Usage: {} [GUESS FEEDBACK]...\n", argv[0]);
+        fmt::print("FEEDBACK has one character per letter: g (right place), y (wrong place), . (not in the word)\n");
+        return EXIT_FAILURE;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed_ms = [](auto since) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count(); };
+
+    const auto lists = wordle::load_word_lists("assets");
+    if (lists.answers.empty()) {
+        fmt::print("[ERROR] Couldn't load the word lists from assets/\n");
+        return EXIT_FAILURE;
+    }
+
+    const auto matrix = wordle::FeedbackMatrix::load_or_build("assets/feedback_matrix.bin", lists.guesses.words(), lists.answers);
+    fmt::print("Loaded {} guesses x {} answers in {:.2f} ms\n", matrix.guess_count(), matrix.answer_count(), elapsed_ms(start));
+
+    wordle::ThreadPool pool;
+    wordle::Solver solver(matrix, &pool);
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view guess_text = argv[i];
+        const auto guess_it = guess_text.size() == wordle::word_length ? std::find(lists.guesses.begin(), lists.guesses.end(), wordle::pack_word(guess_text))
+                                                                       : lists.guesses.end();
+        if (guess_it == lists.guesses.end()) {
+            fmt::print("[ERROR] {} is not an allowed guess\n", guess_text);
+            return EXIT_FAILURE;
+        }
+
+        const auto feedback = parse_feedback(argv[i + 1]);
+        if (not feedback) {
+            fmt::print("[ERROR] {} is not a valid feedback pattern\n", argv[i + 1]);
+            return EXIT_FAILURE;
+        }
+
+        solver.apply(static_cast<std::size_t>(guess_it - lists.guesses.begin()), *feedback);
+    }
+
+    if (solver.remaining().empty()) {
+        fmt::print("No answer matches this history\n");
+        return EXIT_FAILURE;
+    }
+
+    const auto search_start = std::chrono::steady_clock::now();
+    const auto suggestion = solver.best_guess();
+    const auto search_ms = elapsed_ms(search_start);
+
+    fmt::print("{} possible answers\n", solver.remaining().size());
+    fmt::print("Best guess: {} ({:.3f} bits, found in {:.2f} ms on {} threads)\n", wordle::unpack_word(lists.guesses[suggestion.guess]), suggestion.entropy,
+               search_ms, pool.thread_count());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,51 @@
+#include "strategy.hpp"
+
+namespace wordle {
+
+FirstCandidateStrategy::FirstCandidateStrategy(FeedbackMatrix const& matrix) : solver_(matrix) {}
+
+void FirstCandidateStrategy::new_game() {
+    solver_.reset();
+}
+
+std::size_t FirstCandidateStrategy::next_guess() {
+    return solver_.remaining().front();
+}
+
+void FirstCandidateStrategy::observe(std::size_t guess, Feedback feedback) {
+    solver_.apply(guess, feedback);
+}
+
+EntropyStrategy::EntropyStrategy(FeedbackMatrix const& matrix, std::size_t opening_guess) : solver_(matrix), opening_guess_(opening_guess) {}
+
+void EntropyStrategy::new_game() {
+    solver_.reset();
+    is_first_guess_ = true;
+}
+
+std::size_t EntropyStrategy::next_guess() {
+    if (is_first_guess_) {
+        return opening_guess_;
+    }
+    return solver_.best_guess().guess;
+}
+
+void EntropyStrategy::observe(std::size_t guess, Feedback feedback) {
+    is_first_guess_ = false;
+    solver_.apply(guess, feedback);
+}
+
+std::optional<StrategyFactory> make_strategy_factory(std::string_view name, FeedbackMatrix const& matrix, ThreadPool& pool) {
+    if (name == "first") {
+        return [&matrix]() -> std::unique_ptr<Strategy> { return std::make_unique<FirstCandidateStrategy>(matrix); };
+    }
+
+    if (name == "entropy") {
+        const auto opening_guess = Solver(matrix, &pool).best_guess().guess;
+        return [&matrix, opening_guess]() -> std::unique_ptr<Strategy> { return std::make_unique<EntropyStrategy>(matrix, opening_guess); };
+    }
+
+    return {};
+}
+
+}; // namespace wordle
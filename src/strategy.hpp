@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "feedback_matrix.hpp"
+#include "solver.hpp"
+
+namespace wordle {
+
+// Something that plays games: asked for a guess, then told what came back, until the game ends.
+// One instance plays one game at a time on the calling thread, use one per thread.
+class Strategy {
+  public:
+    virtual ~Strategy() = default;
+
+    virtual void new_game() = 0;
+    [[nodiscard]] virtual std::size_t next_guess() = 0;
+    virtual void observe(std::size_t guess, Feedback feedback) = 0;
+};
+
+using StrategyFactory = std::function<std::unique_ptr<Strategy>()>;
+
+// Always plays the first answer that is still possible
+class FirstCandidateStrategy : public Strategy {
+  public:
+    explicit FirstCandidateStrategy(FeedbackMatrix const& matrix);
+
+    void new_game() override;
+    [[nodiscard]] std::size_t next_guess() override;
+    void observe(std::size_t guess, Feedback feedback) override;
+
+  private:
+    Solver solver_;
+};
+
+// Plays the solver's best guess, the opener is the same for every game so it is computed once and shared
+class EntropyStrategy : public Strategy {
+  public:
+    EntropyStrategy(FeedbackMatrix const& matrix, std::size_t opening_guess);
+
+    void new_game() override;
+    [[nodiscard]] std::size_t next_guess() override;
+    void observe(std::size_t guess, Feedback feedback) override;
+
+  private:
+    Solver solver_;
+    std::size_t opening_guess_;
+    bool is_first_guess_ = true;
+};
+
+// Factory for a strategy by name ("first" or "entropy"), nothing if the name is unknown.
+// The pool is only used for precomputation shared by every game.
+std::optional<StrategyFactory> make_strategy_factory(std::string_view name, FeedbackMatrix const& matrix, ThreadPool& pool);
+
+}; // namespace wordle
@@ -0,0 +1,143 @@
+#include <algorithm>
+
+#include "thread_pool.hpp"
+
+namespace wordle {
+
+namespace {
+// Which pool and queue the calling thread works for, if any
+thread_local const void* current_pool = nullptr;
+thread_local std::size_t current_queue = 0;
+
+// Chunks of a parallel_for still to finish. Only touched under the mutex, so that the waiting thread can't return and
+// destroy it while the last chunk is still signalling.
+struct Countdown {
+    std::mutex mutex;
+    std::condition_variable done;
+    std::size_t remaining = 0;
+};
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t thread_count) {
+    thread_count = std::max<std::size_t>(1, thread_count);
+
+    queues_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; i++) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+
+    workers_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; i++) {
+        workers_.emplace_back([this, i]() { worker_loop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    workers_.clear();
+}
+
+void ThreadPool::submit(Task task) {
+    const auto index = current_pool == this ? current_queue : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard lock(sleep_mutex_);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+    wake_.notify_one();
+}
+
+bool ThreadPool::try_run_one(std::size_t home) {
+    Task task;
+
+    if (current_pool == this) {
+        auto& own = *queues_[home];
+        std::lock_guard lock(own.mutex);
+        if (not own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+
+    for (std::size_t i = 1; not task && i <= queues_.size(); i++) {
+        auto& victim = *queues_[(home + i) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+        if (not victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+
+    if (not task) {
+        return false;
+    }
+
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    task();
+    return true;
+}
+
+void ThreadPool::worker_loop(std::size_t index) {
+    current_pool = this;
+    current_queue = index;
+
+    for (;;) {
+        if (try_run_one(index)) {
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex_);
+        wake_.wait(lock, [this]() { return stopping_ || pending_.load(std::memory_order_relaxed) > 0; });
+        if (stopping_) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::parallel_for(std::size_t count, std::size_t grain, std::function<void(std::size_t, std::size_t)> const& body) {
+    grain = std::max<std::size_t>(1, grain);
+    const auto chunk_count = (count + grain - 1) / grain;
+
+    Countdown countdown;
+    countdown.remaining = chunk_count;
+    for (std::size_t chunk = 0; chunk < chunk_count; chunk++) {
+        const auto first = chunk * grain;
+        const auto last = std::min(count, first + grain);
+        submit([&body, &countdown, first, last]() {
+            body(first, last);
+            std::lock_guard lock(countdown.mutex);
+            if (--countdown.remaining == 0) {
+                countdown.done.notify_all();
+            }
+        });
+    }
+
+    // Anyone else sleeps, the pool alone keeps as many cores busy as it has threads
+    if (current_pool != this) {
+        std::unique_lock lock(countdown.mutex);
+        countdown.done.wait(lock, [&countdown]() { return countdown.remaining == 0; });
+        return;
+    }
+
+    // A worker helps instead, which is what lets parallel_for nest
+    for (;;) {
+        {
+            std::lock_guard lock(countdown.mutex);
+            if (countdown.remaining == 0) {
+                return;
+            }
+        }
+        if (not try_run_one(current_queue)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+}; // namespace wordle
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wordle {
+
+// Work-stealing pool: every worker owns a deque, takes its own work from the back and steals from the front of
+// the others when it runs dry. Workers waiting on a parallel_for help instead of blocking, so it can be nested. Any
+// other thread sleeps until it is done, so a pool never keeps more cores busy than it has threads.
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(std::size_t thread_count = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    void submit(Task task);
+
+    // Runs body(first, last) over [0, count) in chunks of at most grain items, returns once every chunk is done.
+    // Callers from outside the pool block meanwhile.
+    void parallel_for(std::size_t count, std::size_t grain, std::function<void(std::size_t, std::size_t)> const& body);
+
+    [[nodiscard]] std::size_t thread_count() const { return queues_.size(); }
+
+  private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool try_run_one(std::size_t home);
+    void worker_loop(std::size_t index);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::jthread> workers_;
+
+    std::atomic<std::size_t> next_queue_ = 0;
+    std::atomic<std::size_t> pending_ = 0;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+}; // namespace wordle
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "trace.hpp"
+
+namespace wordle::trace {
+
+namespace {
+constexpr std::array<const char*, static_cast<std::size_t>(Counter::COUNT)> counter_names = {"score_calls", "entropy_evaluations"};
+
+struct Event {
+    const char* name;
+    std::uint64_t start_ns;
+    std::uint64_t value; // duration, or the counter value for counter events
+    bool is_counter;
+};
+
+// Only its own thread writes to it, the exporter reads up to head
+struct ThreadBuffer {
+    static constexpr std::size_t capacity = std::size_t{1} << 15;
+
+    std::uint32_t thread_id = 0;
+    std::atomic<std::uint64_t> head = 0;
+    std::array<Event, capacity> events{};
+
+    void push(Event const& event) {
+        const auto index = head.load(std::memory_order_relaxed);
+        events[index % capacity] = event;
+        head.store(index + 1, std::memory_order_release);
+    }
+};
+
+// Buffers outlive their threads so that events of finished threads still make it to the file
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+void write_at_exit() {
+    const char* path = std::getenv("WORDLE_TRACE_FILE");
+    const std::filesystem::path trace_path = path != nullptr ? path : "wordle_trace.json";
+    if (write_chrome_trace(trace_path)) {
+        fmt::print("Trace written to {}\n", trace_path.string());
+    } else {
+        fmt::print("[WARNING] Couldn't write the trace to {}\n", trace_path.string());
+    }
+}
+
+ThreadBuffer& thread_buffer() {
+    thread_local ThreadBuffer* buffer = []() {
+        auto& instance = registry();
+        std::lock_guard lock(instance.mutex);
+        if (instance.buffers.empty()) {
+            std::atexit(write_at_exit);
+        }
+        instance.buffers.push_back(std::make_unique<ThreadBuffer>());
+        instance.buffers.back()->thread_id = static_cast<std::uint32_t>(instance.buffers.size());
+        return instance.buffers.back().get();
+    }();
+    return *buffer;
+}
+} // namespace
+
+void record(const char* name, std::uint64_t start_ns, std::uint64_t duration_ns) {
+    thread_buffer().push({name, start_ns, duration_ns, false});
+}
+
+void record_counters() {
+    auto& buffer = thread_buffer();
+    const auto timestamp = now_ns();
+    for (std::size_t i = 0; i < counter_names.size(); i++) {
+        buffer.push({counter_names[i], timestamp, counters[i].load(std::memory_order_relaxed), true});
+    }
+}
+
+bool write_chrome_trace(std::filesystem::path const& path) {
+    auto& instance = registry();
+    std::lock_guard lock(instance.mutex);
+
+    // Oldest event still in a buffer first, in the same order as they were recorded
+    auto for_each_event = [&](auto&& body) {
+        for (auto const& buffer : instance.buffers) {
+            const auto head = buffer->head.load(std::memory_order_acquire);
+            for (auto i = head > ThreadBuffer::capacity ? head - ThreadBuffer::capacity : 0; i < head; i++) {
+                body(*buffer, buffer->events[i % ThreadBuffer::capacity]);
+            }
+        }
+    };
+
+    // Timestamps start at the first event
+    auto start_ns = ~std::uint64_t{0};
+    for_each_event([&](ThreadBuffer const&, Event const& event) { start_ns = std::min(start_ns, event.start_ns); });
+
+    std::ofstream file(path, std::ios::trunc);
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+
+    bool is_first = true;
+    for_each_event([&](ThreadBuffer const& buffer, Event const& event) {
+        const auto timestamp_us = static_cast<double>(event.start_ns - start_ns) / 1000.0;
+        if (event.is_counter) {
+            file << fmt::format("{}{{\"name\": \"{}\", \"ph\": \"C\", \"ts\": {:.3f}, \"pid\": 1, \"tid\": {}, \"args\": {{\"value\": {}}}}}",
+                                is_first ? "" : ",\n", event.name, timestamp_us, buffer.thread_id, event.value);
+        } else {
+            file << fmt::format("{}{{\"name\": \"{}\", \"ph\": \"X\", \"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 1, \"tid\": {}}}", is_first ? "" : ",\n",
+                                event.name, timestamp_us, static_cast<double>(event.value) / 1000.0, buffer.thread_id);
+        }
+        is_first = false;
+    });
+
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
+
+}; // namespace wordle::trace
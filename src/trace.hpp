@@ -0,0 +1,73 @@
+#pragma once
+
+// Scoped timers and counters for profiling. Everything here only exists when built with the WORDLE_TRACING CMake
+// option, otherwise the macros expand to nothing and trace.cpp isn't even compiled.
+//
+// WORDLE_TRACE_SCOPE("name") times the enclosing scope, names must be string literals.
+// WORDLE_TRACE_COUNT(SCORE_CALLS, n) adds n to a counter.
+// WORDLE_TRACE_COUNTERS() records the current value of every counter, once per frame is plenty.
+//
+// The trace is written as Chrome trace JSON when the program exits, to $WORDLE_TRACE_FILE or wordle_trace.json.
+// Open it in chrome://tracing or ui.perfetto.dev.
+
+#ifdef WORDLE_TRACING
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace wordle::trace {
+
+enum class Counter : std::size_t { SCORE_CALLS, ENTROPY_EVALUATIONS, COUNT };
+
+inline std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(Counter::COUNT)> counters{};
+
+inline void add(Counter counter, std::uint64_t amount) {
+    counters[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline std::uint64_t value(Counter counter) {
+    return counters[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline std::uint64_t now_ns() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Appends to the calling thread's ring buffer, the oldest events are overwritten once it is full
+void record(const char* name, std::uint64_t start_ns, std::uint64_t duration_ns);
+void record_counters();
+
+bool write_chrome_trace(std::filesystem::path const& path);
+
+class Scope {
+  public:
+    explicit Scope(const char* name) : name_(name), start_ns_(now_ns()) {}
+    ~Scope() { record(name_, start_ns_, now_ns() - start_ns_); }
+
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+
+  private:
+    const char* name_;
+    std::uint64_t start_ns_;
+};
+
+}; // namespace wordle::trace
+
+#define WORDLE_TRACE_CONCAT_INNER(a, b) a##b
+#define WORDLE_TRACE_CONCAT(a, b) WORDLE_TRACE_CONCAT_INNER(a, b)
+#define WORDLE_TRACE_SCOPE(name) const ::wordle::trace::Scope WORDLE_TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#define WORDLE_TRACE_COUNT(counter, amount) ::wordle::trace::add(::wordle::trace::Counter::counter, amount)
+#define WORDLE_TRACE_COUNTERS() ::wordle::trace::record_counters()
+
+#else
+
+#define WORDLE_TRACE_SCOPE(name)
+#define WORDLE_TRACE_COUNT(counter, amount)
+#define WORDLE_TRACE_COUNTERS()
+
+#endif
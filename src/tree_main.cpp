@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "decision_tree.hpp"
+#include "feedback_matrix.hpp"
+#include "solver.hpp"
+#include "thread_pool.hpp"
+#include "word_list.hpp"
+
+namespace {
+struct Options {
+    std::size_t word_length = wordle::word_length;
+    std::string opener;
+    std::string output; // where the game looks for the tree of this length when empty
+    std::size_t threads = 0;
+};
+
+// Same files as the game uses for this length
+template <std::size_t N>
+int build_tree(Options options) {
+    const auto lists = wordle::load_word_lists<N>("assets");
+    if (lists.answers.empty()) {
+        fmt::print("[ERROR] Couldn't load the {} letter word lists from assets/\n", N);
+        return EXIT_FAILURE;
+    }
+    const auto matrix_path = N == wordle::word_length ? std::string("assets/feedback_matrix.bin") : fmt::format("assets/feedback_matrix_{}.bin", N);
+    const auto matrix = wordle::BasicFeedbackMatrix<N>::load_or_build(matrix_path, lists.guesses.words(), lists.answers);
+    if (options.output.empty()) {
+        options.output = N == wordle::word_length ? std::string("assets/decision_tree.bin") : fmt::format("assets/decision_tree_{}.bin", N);
+    }
+
+    wordle::ThreadPool pool(options.threads != 0 ? options.threads : std::thread::hardware_concurrency());
+
+    std::size_t opener = 0;
+    if (options.opener.empty()) {
+        opener = wordle::BasicSolver<N>(matrix, &pool).best_guess().guess;
+    } else {
+        const auto it = std::find(lists.guesses.begin(), lists.guesses.end(), wordle::pack_word(options.opener));
+        if (options.opener.size() != N || it == lists.guesses.end()) {
+            fmt::print("[ERROR] {} is not an allowed guess\n", options.opener);
+            return EXIT_FAILURE;
+        }
+        opener = static_cast<std::size_t>(it - lists.guesses.begin());
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto tree = wordle::BasicDecisionTree<N>::build(matrix, opener, pool);
+    const auto build_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (not tree.save(options.output)) {
+        fmt::print("[ERROR] Couldn't write {}\n", options.output);
+        return EXIT_FAILURE;
+    }
+
+    // Plays every answer by walking the tree, which checks it and times the lookups at the same time
+    std::vector<std::size_t> histogram;
+    std::size_t total_guesses = 0;
+    std::size_t moves = 0;
+    const auto walk_start = std::chrono::steady_clock::now();
+    for (std::size_t answer = 0; answer < lists.answers.size(); answer++) {
+        std::uint32_t node = wordle::BasicDecisionTree<N>::root;
+        std::size_t guesses = 1;
+        while (tree.guess(node) != answer) {
+            const auto next = tree.child(node, matrix.at(tree.guess(node), answer));
+            if (not next) {
+                fmt::print("[ERROR] The tree doesn't reach {}\n", wordle::unpack_word(lists.answers[answer]));
+                return EXIT_FAILURE;
+            }
+            node = *next;
+            guesses++;
+        }
+        histogram.resize(std::max(histogram.size(), guesses + 1));
+        histogram[guesses]++;
+        total_guesses += guesses;
+        moves += guesses - 1;
+    }
+    const auto walk_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - walk_start).count();
+
+    fmt::print("Tree from {} built in {:.3f} s on {} threads\n", wordle::unpack_word(lists.guesses[opener]), build_s, pool.thread_count());
+    fmt::print("{} nodes, {} bytes written to {}\n", tree.node_count(), std::filesystem::file_size(options.output), options.output);
+    for (std::size_t guesses = 1; guesses < histogram.size(); guesses++) {
+        fmt::print("  {} guesses: {}\n", guesses, histogram[guesses]);
+    }
+    fmt::print("Mean guesses {:.4f}, {:.1f} ns per move\n", static_cast<double>(total_guesses) / static_cast<double>(lists.answers.size()),
+               walk_ns / static_cast<double>(std::max<std::size_t>(1, moves)));
+
+    return EXIT_SUCCESS;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--length" && has_value) {
+            options.word_length = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--opener" && has_value) {
+            options.opener = argv[++i];
+        } else if (arg == "--output" && has_value) {
+            options.output = argv[++i];
+        } else if (arg == "--threads" && has_value) {
+            options.threads = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            fmt::print("Usage: {} [--length {}-{}] [--opener WORD] [--output FILE] [--threads N]\n", argv[0], wordle::min_word_length,
+                       wordle::max_word_length);
+            return EXIT_FAILURE;
+        }
+    }
+
+    switch (options.word_length) {
+        case 4:
+            return build_tree<4>(options);
+        case 5:
+            return build_tree<5>(options);
+        case 6:
+            return build_tree<6>(options);
+        case 7:
+            return build_tree<7>(options);
+        case 8:
+            return build_tree<8>(options);
+        default:
+            fmt::print("[ERROR] Words must have between {} and {} letters\n", wordle::min_word_length, wordle::max_word_length);
+            return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include "dictionary.hpp"
+#include "trace.hpp"
+#include "word_corpus.hpp"
+
+namespace wordle {
+
+namespace {
+// Lines are parsed in chunks of about this size, a batch of them in parallel. Reading a batch, its parsed words and
+// the index of the words so far is all the memory used on top of the result.
+constexpr std::size_t chunk_size = std::size_t{1} << 18;
+constexpr std::size_t max_chunks_per_batch = 8;
+constexpr std::size_t max_reserved_words = std::size_t{1} << 24;
+
+// Base letter of U+00C0 to U+00FF, which UTF-8 encodes as 0xC3 0x80 to 0xC3 0xBF. 0 for the ones without one.
+constexpr std::array<char, 64> latin1_letters = {
+    'A', 'A', 'A', 'A', 'A', 'A', 0, 'C', 'E', 'E', 'E', 'E', 'I', 'I', 'I', 'I', // À Á Â Ã Ä Å Æ Ç È É Ê Ë Ì Í Î Ï
+    0,   'N', 'O', 'O', 'O', 'O', 'O', 0, 'O', 'U', 'U', 'U', 'U', 'Y', 0,   0,   // Ð Ñ Ò Ó Ô Õ Ö × Ø Ù Ú Û Ü Ý Þ ß
+    'A', 'A', 'A', 'A', 'A', 'A', 0, 'C', 'E', 'E', 'E', 'E', 'I', 'I', 'I', 'I', // à á â ã ä å æ ç è é ê ë ì í î ï
+    0,   'N', 'O', 'O', 'O', 'O', 'O', 0, 'O', 'U', 'U', 'U', 'U', 'Y', 0,   'Y', // ð ñ ò ó ô õ ö ÷ ø ù ú û ü ý þ ÿ
+};
+
+constexpr bool is_separator(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+}
+
+struct Entry {
+    PackedWord word;
+    float weight;
+};
+
+struct ChunkResult {
+    std::vector<Entry> entries;
+    std::size_t skipped_lines = 0;
+    bool has_weights = false;
+};
+
+template <std::size_t N>
+void parse_line(std::string_view line, ChunkResult& result) {
+    std::size_t i = 0;
+    while (i < line.size() && is_separator(line[i])) {
+        i++;
+    }
+    if (i == line.size()) {
+        return;
+    }
+
+    PackedWord word = 0;
+    std::size_t letters = 0;
+    for (; i < line.size() && not is_separator(line[i]); i++) {
+        auto c = static_cast<unsigned char>(line[i]);
+        if (c == 0xC3 && i + 1 < line.size() && (static_cast<unsigned char>(line[i + 1]) & 0xC0) == 0x80) {
+            c = static_cast<unsigned char>(latin1_letters[static_cast<unsigned char>(line[++i]) - 0x80]);
+        } else if (c >= 'a' && c <= 'z') {
+            c = static_cast<unsigned char>(c - 'a' + 'A');
+        }
+        if (c < 'A' || c > 'Z' || letters == N) {
+            result.skipped_lines++;
+            return;
+        }
+        word |= PackedWord{c} << (8 * letters++);
+    }
+    if (letters != N) {
+        result.skipped_lines++;
+        return;
+    }
+
+    while (i < line.size() && is_separator(line[i])) {
+        i++;
+    }
+
+    // Whatever follows the frequency is ignored
+    float weight = 1.0f;
+    if (i < line.size()) {
+        const auto [end, error] = std::from_chars(line.data() + i, line.data() + line.size(), weight);
+        if (error != std::errc() || not std::isfinite(weight) || weight < 0.0f) {
+            result.skipped_lines++;
+            return;
+        }
+        result.has_weights = true;
+    }
+
+    result.entries.push_back({word, weight});
+}
+
+template <std::size_t N>
+void parse_chunk(std::string_view chunk, ChunkResult& result) {
+    result.entries.clear();
+    result.skipped_lines = 0;
+    result.has_weights = false;
+
+    while (not chunk.empty()) {
+        const auto line_end = std::min(chunk.find('\n'), chunk.size());
+        parse_line<N>(chunk.substr(0, line_end), result);
+        chunk.remove_prefix(std::min(line_end + 1, chunk.size()));
+    }
+}
+
+// Words seen so far and where they are in the corpus, open addressing like BasicDictionary
+class WordIndex {
+  public:
+    // Position of the word, added at `position` if it is new
+    std::size_t insert(std::span<const PackedWord> words, PackedWord word, std::size_t position) {
+        if (2 * (size_ + 1) > slots_.size()) {
+            grow(words);
+        }
+        auto slot = hash_slot(word, shift_);
+        while (slots_[slot] != 0) {
+            if (words[slots_[slot] - 1] == word) {
+                return slots_[slot] - 1;
+            }
+            slot = (slot + 1) & (slots_.size() - 1);
+        }
+        slots_[slot] = static_cast<std::uint32_t>(position + 1);
+        size_++;
+        return position;
+    }
+
+  private:
+    void grow(std::span<const PackedWord> words) {
+        const auto old_slots = std::move(slots_);
+        slots_.assign(std::max<std::size_t>(16, 2 * old_slots.size()), 0);
+        shift_ = 64 - static_cast<unsigned>(std::countr_zero(slots_.size()));
+        for (const auto position : old_slots) {
+            if (position != 0) {
+                auto slot = hash_slot(words[position - 1], shift_);
+                while (slots_[slot] != 0) {
+                    slot = (slot + 1) & (slots_.size() - 1);
+                }
+                slots_[slot] = position;
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> slots_; // position + 1, 0 for empty slots
+    std::size_t size_ = 0;
+    unsigned shift_ = 64;
+};
+} // namespace
+
+template <std::size_t N>
+std::optional<WordCorpus> read_word_corpus(std::filesystem::path const& path, ThreadPool* pool) {
+    WORDLE_TRACE_SCOPE("read_word_corpus");
+
+    std::ifstream file(path, std::ios::binary);
+    if (not file) {
+        return {};
+    }
+
+    const auto chunks_per_batch = pool != nullptr ? std::clamp<std::size_t>(pool->thread_count(), 1, max_chunks_per_batch) : 1;
+    const auto buffer_size = chunks_per_batch * chunk_size;
+    const auto buffer = std::make_unique_for_overwrite<char[]>(buffer_size);
+    std::vector<std::string_view> chunks;
+    std::vector<ChunkResult> results(chunks_per_batch);
+    for (auto& result : results) {
+        result.entries.reserve(chunk_size / (N + 1) + 1);
+    }
+
+    // Room for as many words as the file could hold, up to a point. Only the pages that get written to are ever backed
+    // by memory.
+    WordCorpus corpus;
+    std::error_code error;
+    const auto file_size = std::filesystem::file_size(path, error);
+    if (not error) {
+        corpus.words.reserve(static_cast<std::size_t>(std::min<std::uintmax_t>(file_size / (N + 1) + 1, max_reserved_words)));
+        corpus.weights.reserve(corpus.words.capacity());
+    }
+
+    // Weights are always tracked, whether the file has frequencies is only known at the end
+    WordIndex index;
+    bool has_weights = false;
+
+    // Every chunk is added in file order, so the first occurrence of a word decides where it goes
+    auto add_batch = [&](std::string_view batch) {
+        chunks.clear();
+        while (not batch.empty()) {
+            auto end = std::min(chunk_size, batch.size());
+            end = end == batch.size() ? end : std::min(batch.find('\n', end), batch.size() - 1) + 1;
+            chunks.push_back(batch.substr(0, end));
+            batch.remove_prefix(end);
+        }
+
+        if (pool != nullptr && chunks.size() > 1) {
+            pool->parallel_for(chunks.size(), 1, [&](std::size_t first, std::size_t last) {
+                for (auto c = first; c < last; c++) {
+                    parse_chunk<N>(chunks[c], results[c]);
+                }
+            });
+        } else {
+            for (std::size_t c = 0; c < chunks.size(); c++) {
+                parse_chunk<N>(chunks[c], results[c]);
+            }
+        }
+
+        for (std::size_t c = 0; c < chunks.size(); c++) {
+            corpus.skipped_lines += results[c].skipped_lines;
+            has_weights = has_weights || results[c].has_weights;
+            for (const auto entry : results[c].entries) {
+                const auto position = index.insert(corpus.words, entry.word, corpus.words.size());
+                if (position == corpus.words.size()) {
+                    corpus.words.push_back(entry.word);
+                    corpus.weights.push_back(entry.weight);
+                } else {
+                    corpus.weights[position] += entry.weight;
+                    corpus.duplicates++;
+                }
+            }
+        }
+    };
+
+    // The buffer starts with the unfinished last line of the previous batch
+    std::size_t filled = 0;
+    bool is_first_read = true;
+    bool is_skipping_line = false; // a line longer than the whole buffer, it can't be a word
+    for (bool at_end = false; not at_end;) {
+        file.read(buffer.get() + filled, static_cast<std::streamsize>(buffer_size - filled));
+        filled += static_cast<std::size_t>(file.gcount());
+        at_end = not file;
+        if (file.bad()) {
+            return {};
+        }
+
+        std::size_t begin = 0;
+        if (is_first_read && std::string_view(buffer.get(), filled).starts_with("\xEF\xBB\xBF")) {
+            begin = 3;
+        }
+        is_first_read = false;
+
+        if (is_skipping_line) {
+            const auto line_end = std::string_view(buffer.get() + begin, filled - begin).find('\n');
+            is_skipping_line = line_end == std::string_view::npos;
+            begin = is_skipping_line ? filled : begin + line_end + 1;
+        }
+
+        // Up to the last complete line, or everything once the whole file is read
+        auto end = filled;
+        if (not at_end) {
+            const auto last_line_end = std::string_view(buffer.get() + begin, filled - begin).rfind('\n');
+            if (last_line_end == std::string_view::npos && begin < filled) {
+                corpus.skipped_lines++;
+                is_skipping_line = true;
+                begin = filled;
+            } else if (last_line_end != std::string_view::npos) {
+                end = begin + last_line_end + 1;
+            }
+        }
+
+        add_batch(std::string_view(buffer.get() + begin, end - begin));
+
+        std::memmove(buffer.get(), buffer.get() + end, filled - end);
+        filled -= end;
+    }
+
+    // The index goes first, the room it frees is what the shrinking copies go into
+    index = {};
+    if (not has_weights) {
+        corpus.weights = {};
+    }
+    corpus.words.shrink_to_fit();
+    corpus.weights.shrink_to_fit();
+    return corpus;
+}
+
+template std::optional<WordCorpus> read_word_corpus<4>(std::filesystem::path const&, ThreadPool*);
+template std::optional<WordCorpus> read_word_corpus<5>(std::filesystem::path const&, ThreadPool*);
+template std::optional<WordCorpus> read_word_corpus<6>(std::filesystem::path const&, ThreadPool*);
+template std::optional<WordCorpus> read_word_corpus<7>(std::filesystem::path const&, ThreadPool*);
+template std::optional<WordCorpus> read_word_corpus<8>(std::filesystem::path const&, ThreadPool*);
+
+}; // namespace wordle
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "scoring.hpp"
+#include "thread_pool.hpp"
+
+namespace wordle {
+
+// Words of a word list file, normalized and without duplicates.
+//
+// One word per line, optionally followed by a frequency: "word", "word 1234", "word,1234" or "word\t1234". Lines can
+// end in CRLF, case doesn't matter and accented latin letters (UTF-8) count as their base letter. Anything else that
+// isn't N letters after that is skipped. Duplicates keep the position of their first occurrence and add up their
+// frequencies, a line without one counting as 1.
+struct WordCorpus {
+    std::vector<PackedWord> words;
+    std::vector<float> weights; // one per word, empty when the file has no frequencies
+    std::size_t skipped_lines = 0;
+    std::size_t duplicates = 0;
+};
+
+// Streams the file in fixed size chunks, parsed in parallel when given a pool, so memory stays close to the size of
+// the packed words whatever the size of the file. Nothing if the file can't be read.
+template <std::size_t N = word_length>
+std::optional<WordCorpus> read_word_corpus(std::filesystem::path const& path, ThreadPool* pool = nullptr);
+
+}; // namespace wordle
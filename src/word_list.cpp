@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <string>
+
+#include "word_corpus.hpp"
+#include "word_list.hpp"
+#include "trace.hpp"
+
+namespace wordle {
+
+template <std::size_t N>
+BasicWordLists<N> load_word_lists(std::filesystem::path const& assets_path, ThreadPool* pool) {
+    const auto pack = "words-" + std::to_string(N);
+    const auto answers_file = N == word_length ? std::string("wordle-answers-alphabetical.txt") : pack + "-answers.txt";
+    const auto allowed_file = N == word_length ? std::string("wordle-allowed-guesses.txt") : pack + "-allowed.txt";
+
+    return load_word_list_files<N>(assets_path / answers_file, assets_path / allowed_file, pool);
+}
+
+template <std::size_t N>
+BasicWordLists<N> load_word_list_files(std::filesystem::path const& answers_path, std::filesystem::path const& allowed_path, ThreadPool* pool) {
+    WORDLE_TRACE_SCOPE("load_word_lists");
+
+    BasicWordLists<N> unreadable;
+    auto answers = read_word_corpus<N>(answers_path, pool);
+    if (not answers) {
+        unreadable.unreadable_file = answers_path;
+        return unreadable;
+    }
+    auto allowed = allowed_path.empty() ? WordCorpus{} : read_word_corpus<N>(allowed_path, pool);
+    if (not allowed) {
+        unreadable.unreadable_file = allowed_path;
+        return unreadable;
+    }
+
+    std::vector<PackedWord> guesses;
+    guesses.reserve(answers->words.size() + allowed->words.size());
+    guesses.insert(guesses.end(), answers->words.begin(), answers->words.end());
+    // Sorted for a moment to find the allowed guesses that are answers, then back in the order of the answers
+    std::sort(guesses.begin(), guesses.end());
+    std::erase_if(allowed->words, [&](PackedWord word) { return std::binary_search(guesses.begin(), guesses.end(), word); });
+    std::copy(answers->words.begin(), answers->words.end(), guesses.begin());
+    guesses.insert(guesses.end(), allowed->words.begin(), allowed->words.end());
+    allowed.reset();
+
+    // Frequencies that are all 0 say nothing, the answers are then all as likely
+    auto& weights = answers->weights;
+    if (std::all_of(weights.begin(), weights.end(), [](float weight) { return weight == 0.0f; })) {
+        weights = {};
+    }
+
+    return {std::move(answers->words), BasicDictionary<N>(std::move(guesses)), std::move(weights), {}};
+}
+
+template BasicWordLists<4> load_word_lists<4>(std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<5> load_word_lists<5>(std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<6> load_word_lists<6>(std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<7> load_word_lists<7>(std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<8> load_word_lists<8>(std::filesystem::path const&, ThreadPool*);
+
+template BasicWordLists<4> load_word_list_files<4>(std::filesystem::path const&, std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<5> load_word_list_files<5>(std::filesystem::path const&, std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<6> load_word_list_files<6>(std::filesystem::path const&, std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<7> load_word_list_files<7>(std::filesystem::path const&, std::filesystem::path const&, ThreadPool*);
+template BasicWordLists<8> load_word_list_files<8>(std::filesystem::path const&, std::filesystem::path const&, ThreadPool*);
+
+}; // namespace wordle
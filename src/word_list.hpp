@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+#include "dictionary.hpp"
+#include "scoring.hpp"
+#include "thread_pool.hpp"
+
+namespace wordle {
+
+// Answers keep the order of their file. Guesses start with every answer, in the same order, followed by the
+// other allowed guesses, so answer i is also guess i.
+template <std::size_t N>
+struct BasicWordLists {
+    std::vector<PackedWord> answers;
+    BasicDictionary<N> guesses;
+    std::vector<float> answer_weights; // one per answer from the frequencies of the answers file, empty when they are all as likely
+    std::filesystem::path unreadable_file; // the file that couldn't be read when the lists are empty because of it
+};
+
+using WordLists = BasicWordLists<word_length>;
+
+// Classic 5 letter lists are wordle-answers-alphabetical.txt and wordle-allowed-guesses.txt, other lengths come
+// from their own pack: words-N-answers.txt and words-N-allowed.txt. Both lists are empty if a file is missing.
+template <std::size_t N = word_length>
+BasicWordLists<N> load_word_lists(std::filesystem::path const& assets_path, ThreadPool* pool = nullptr);
+
+// Any pair of word list files, see read_word_corpus for what they can hold. Allowed guesses that are also answers
+// are only listed once, and without an allowed file the answers are the only guesses.
+template <std::size_t N = word_length>
+BasicWordLists<N> load_word_list_files(std::filesystem::path const& answers_path, std::filesystem::path const& allowed_path, ThreadPool* pool = nullptr);
+
+}; // namespace wordle
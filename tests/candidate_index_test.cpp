@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#ifdef CATCH3
+#include <catch2/catch_test_macros.hpp>
+#else
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#endif
+
+#include "candidate_index.hpp"
+#include "random_words.hpp"
+#include "scoring.hpp"
+#include "word_list.hpp"
+
+namespace {
+// Plays random games and after every guess checks the index against rescanning every answer with score
+template <std::size_t N>
+void check_random_games(std::span<const wordle::PackedWord> answers, std::span<const wordle::PackedWord> guesses, std::size_t games, std::mt19937& rand) {
+    wordle::BasicCandidateIndex<N> candidates(answers);
+    std::uniform_int_distribution<std::size_t> pick_answer(0, answers.size() - 1);
+    std::uniform_int_distribution<std::size_t> pick_guess(0, guesses.size() - 1);
+    std::vector<std::pair<wordle::PackedWord, wordle::FeedbackOf<N>>> played;
+    std::vector<std::uint32_t> first(12);
+
+    for (std::size_t game = 0; game < games; game++) {
+        candidates.reset();
+        played.clear();
+        const auto answer = pick_answer(rand);
+
+        for (std::size_t turn = 0; turn < 6; turn++) {
+            const auto guess = guesses[pick_guess(rand)];
+            const auto feedback = wordle::score<N>(answers[answer], guess);
+            candidates.apply(guess, feedback);
+            played.emplace_back(guess, feedback);
+
+            std::size_t mismatches = 0;
+            std::vector<std::uint32_t> expected;
+            for (std::size_t a = 0; a < answers.size(); a++) {
+                const bool is_possible =
+                    std::all_of(played.begin(), played.end(), [&](auto const& move) { return wordle::score<N>(answers[a], move.first) == move.second; });
+                if (is_possible) {
+                    expected.push_back(static_cast<std::uint32_t>(a));
+                }
+                if (candidates.contains(a) != is_possible) {
+                    if (mismatches == 0) {
+                        UNSCOPED_INFO("first mismatch: answer " << wordle::unpack_word(answers[a]) << " after " << played.size() << " guesses, last "
+                                                                << wordle::unpack_word(guess));
+                    }
+                    mismatches++;
+                }
+            }
+            REQUIRE(mismatches == 0);
+            REQUIRE(candidates.count() == expected.size());
+            REQUIRE(candidates.contains(answer));
+
+            const auto written = candidates.first_candidates(first);
+            expected.resize(std::min(expected.size(), first.size()));
+            REQUIRE(std::vector<std::uint32_t>(first.begin(), first.begin() + static_cast<long>(written)) == expected);
+
+            if (feedback == wordle::WordTraits<N>::all_valid_feedback) {
+                break;
+            }
+        }
+    }
+}
+} // namespace
+
+TEST_CASE("Candidate index matches rescanning the bundled lists", "[candidate_index]") {
+    const auto lists = wordle::load_word_lists(WORDLE_ASSETS_DIR);
+    REQUIRE(not lists.answers.empty());
+
+    std::mt19937 rand(5);
+    check_random_games<wordle::word_length>(lists.answers, lists.guesses.words(), 300, rand);
+}
+
+TEST_CASE("Candidate index matches rescanning 7 letter words", "[candidate_index]") {
+    // A small alphabet, so that games are full of repeated and misplaced letters
+    std::mt19937 rand(7);
+    const auto answers = wordle::test::random_words<7>(1000, 'H', rand);
+    auto guesses = wordle::test::random_words<7>(2000, 'H', rand);
+    guesses.insert(guesses.end(), answers.begin(), answers.end());
+
+    check_random_games<7>(answers, guesses, 300, rand);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "scoring.hpp"
+
+namespace wordle::test {
+
+// Letters from a small alphabet so that repeated letters are common
+template <std::size_t N>
+std::vector<PackedWord> random_words(std::size_t count, char last_letter, std::mt19937& rand) {
+    std::uniform_int_distribution<int> letter('A', last_letter);
+    std::vector<PackedWord> words(count);
+    for (auto& word : words) {
+        std::string text(N, 'A');
+        for (auto& c : text) {
+            c = static_cast<char>(letter(rand));
+        }
+        word = pack_word(text);
+    }
+    return words;
+}
+
+}; // namespace wordle::test
@@ -0,0 +1,72 @@
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#ifdef CATCH3
+#include <catch2/catch_test_macros.hpp>
+#else
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#endif
+
+#include "random_words.hpp"
+#include "scoring.hpp"
+#include "word_list.hpp"
+
+namespace {
+// Scores every guess against every answer with score, score_batch and check_validity, and counts disagreements
+template <std::size_t N>
+std::size_t count_mismatches(std::span<const wordle::PackedWord> guesses, std::span<const wordle::PackedWord> answers) {
+    std::size_t mismatches = 0;
+    std::vector<wordle::FeedbackOf<N>> batch(answers.size());
+
+    for (const auto guess : guesses) {
+        wordle::score_batch<N>(guess, answers, batch);
+        const auto guess_text = wordle::unpack_word(guess);
+
+        for (std::size_t a = 0; a < answers.size(); a++) {
+            const auto expected = wordle::encode_feedback<N>(wordle::check_validity(wordle::unpack_word(answers[a]), guess_text));
+            if (wordle::score<N>(answers[a], guess) != expected || batch[a] != expected) {
+                if (mismatches == 0) {
+                    UNSCOPED_INFO("first mismatch: guess " << guess_text << ", answer " << wordle::unpack_word(answers[a]));
+                }
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+template <std::size_t N>
+void check_random_words() {
+    std::mt19937 rand(static_cast<std::uint32_t>(N));
+    for (const auto last_letter : {'D', 'Z'}) {
+        const auto guesses = wordle::test::random_words<N>(300, last_letter, rand);
+        const auto answers = wordle::test::random_words<N>(300, last_letter, rand);
+        INFO(N << " letters, alphabet up to " << last_letter);
+        REQUIRE(count_mismatches<N>(guesses, answers) == 0);
+    }
+}
+} // namespace
+
+TEST_CASE("Packed scoring matches check_validity on the bundled lists", "[scoring]") {
+    const auto lists = wordle::load_word_lists(WORDLE_ASSETS_DIR);
+    REQUIRE(not lists.answers.empty());
+    REQUIRE(count_mismatches<wordle::word_length>(lists.guesses.words(), lists.answers) == 0);
+}
+
+TEST_CASE("Packed scoring matches check_validity with repeated letters", "[scoring]") {
+    const std::vector<wordle::PackedWord> words = {wordle::pack_word("SPEED"), wordle::pack_word("ABIDE"), wordle::pack_word("LLAMA"),
+                                                   wordle::pack_word("ALLOY"), wordle::pack_word("EERIE"), wordle::pack_word("ELDER"),
+                                                   wordle::pack_word("MAMMA"), wordle::pack_word("AMASS"), wordle::pack_word("SASSY")};
+    REQUIRE(count_mismatches<wordle::word_length>(words, words) == 0);
+}
+
+TEST_CASE("Packed scoring matches check_validity for every word length", "[scoring]") {
+    check_random_words<4>();
+    check_random_words<5>();
+    check_random_words<6>();
+    check_random_words<7>();
+    check_random_words<8>();
+}
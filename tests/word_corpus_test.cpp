@@ -0,0 +1,157 @@
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#ifdef CATCH3
+#include <catch2/catch_test_macros.hpp>
+#else
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#endif
+
+#include "thread_pool.hpp"
+#include "word_corpus.hpp"
+
+namespace {
+std::filesystem::path write_file(std::string const& name, std::string_view content) {
+    const auto path = std::filesystem::temp_directory_path() / ("wordle_corpus_test_" + name);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return path;
+}
+
+// Reads the file with and without a pool, which split it in chunks differently, and checks that both agree
+wordle::WordCorpus read_both_ways(std::filesystem::path const& path) {
+    wordle::ThreadPool pool(4);
+    auto alone = wordle::read_word_corpus<5>(path);
+    auto pooled = wordle::read_word_corpus<5>(path, &pool);
+    REQUIRE(alone);
+    REQUIRE(pooled);
+    CHECK(alone->words == pooled->words);
+    CHECK(alone->weights == pooled->weights);
+    CHECK(alone->skipped_lines == pooled->skipped_lines);
+    CHECK(alone->duplicates == pooled->duplicates);
+    return std::move(*alone);
+}
+
+std::vector<std::string> unpack_all(std::span<const wordle::PackedWord> words) {
+    std::vector<std::string> result;
+    for (const auto word : words) {
+        result.push_back(wordle::unpack_word(word));
+    }
+    return result;
+}
+
+// Fifth letter first so that consecutive indices give words that differ everywhere
+std::string word_of(std::size_t index) {
+    std::string word(5, 'A');
+    for (auto& c : word) {
+        c = static_cast<char>('A' + index % 26);
+        index /= 26;
+    }
+    return word;
+}
+} // namespace
+
+TEST_CASE("Word lists are normalized and deduplicated", "[word_corpus]") {
+    const auto path = write_file("formats.txt", "\xEF\xBB\xBF"
+                                                "speed\r\n"
+                                                "  Abide 3\n"
+                                                "\n"
+                                                "llama,2\r\n"
+                                                "ALLOY\t4 trailing words\n"
+                                                "cr\xC3\xA8me\n"
+                                                "speed 5\n"
+                                                "abid\n"
+                                                "abides\n"
+                                                "ab1de\n"
+                                                "gr\xC3\xA6"
+                                                "ce\n"
+                                                "spice x\n"
+                                                "spice -1\n"
+                                                " \t;\r\n");
+    const auto corpus = read_both_ways(path);
+
+    CHECK(unpack_all(corpus.words) == std::vector<std::string>{"SPEED", "ABIDE", "LLAMA", "ALLOY", "CREME"});
+    CHECK(corpus.weights == std::vector<float>{6.0f, 3.0f, 2.0f, 4.0f, 1.0f});
+    CHECK(corpus.skipped_lines == 6);
+    CHECK(corpus.duplicates == 1);
+}
+
+TEST_CASE("Lists without frequencies have no weights", "[word_corpus]") {
+    const auto corpus = read_both_ways(write_file("plain.txt", "speed\nabide\nspeed\n"));
+
+    CHECK(unpack_all(corpus.words) == std::vector<std::string>{"SPEED", "ABIDE"});
+    CHECK(corpus.weights.empty());
+    CHECK(corpus.duplicates == 1);
+}
+
+TEST_CASE("Unreadable files give nothing", "[word_corpus]") {
+    CHECK_FALSE(wordle::read_word_corpus<5>(std::filesystem::temp_directory_path() / "wordle_corpus_test_missing.txt"));
+}
+
+TEST_CASE("Duplicates across the 256 KiB chunk boundary add up", "[word_corpus]") {
+    // The second APPLE ends right at the first chunk boundary, the first frequency of the file comes after it
+    std::string content = "apple\n";
+    while (content.size() < 262140 - 10) {
+        content += "xxxxxxxxx\n";
+    }
+    content.resize(262140 - 1, 'y');
+    content += "\napple\nzebra 5\n";
+
+    const auto corpus = read_both_ways(write_file("boundary.txt", content));
+
+    CHECK(unpack_all(corpus.words) == std::vector<std::string>{"APPLE", "ZEBRA"});
+    CHECK(corpus.weights == std::vector<float>{2.0f, 5.0f});
+    CHECK(corpus.duplicates == 1);
+}
+
+TEST_CASE("Big lists match a straightforward count", "[word_corpus]") {
+    // Lines of varying length over a few MB, so that chunk and batch boundaries land anywhere in a line
+    std::string content;
+    std::vector<std::string> expected_words;
+    std::unordered_map<std::string, std::size_t> positions;
+    std::vector<float> expected_weights;
+    std::size_t duplicates = 0;
+    std::size_t skipped = 0;
+    for (std::size_t line = 0; line < 200000; line++) {
+        const auto word = word_of((line * 7919) % 60000);
+        const auto weight = static_cast<float>(line % 5);
+        content += std::string(line % 3, ' ') + word + std::string(1 + line % 11, ' ') + std::to_string(line % 5) + "\n";
+        if (line % 13 == 0) {
+            content += "toolongword 1\n";
+            skipped++;
+        }
+
+        const auto [it, is_new] = positions.try_emplace(word, expected_words.size());
+        if (is_new) {
+            expected_words.push_back(word);
+            expected_weights.push_back(weight);
+        } else {
+            expected_weights[it->second] += weight;
+            duplicates++;
+        }
+    }
+
+    const auto corpus = read_both_ways(write_file("big.txt", content));
+
+    CHECK(unpack_all(corpus.words) == expected_words);
+    CHECK(corpus.weights == expected_weights);
+    CHECK(corpus.skipped_lines == skipped);
+    CHECK(corpus.duplicates == duplicates);
+}
+
+TEST_CASE("Lines longer than the read buffer are skipped once", "[word_corpus]") {
+    // Longer than the buffer of any pool, 8 chunks of 256 KiB
+    const auto content = "speed\n" + std::string(3 << 20, 'a') + "\nabide 2\n" + std::string((1 << 20) + 5, 'b') + "\nllama\n";
+
+    const auto corpus = read_both_ways(write_file("long.txt", content));
+
+    CHECK(unpack_all(corpus.words) == std::vector<std::string>{"SPEED", "ABIDE", "LLAMA"});
+    CHECK(corpus.weights == std::vector<float>{1.0f, 2.0f, 1.0f});
+    CHECK(corpus.skipped_lines == 2);
+}